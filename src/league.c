@@ -11,6 +11,7 @@
 /* INCLUDE STATEMENTS */
 
 #include "league.h"
+#include "standings.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -20,6 +21,16 @@
 /* HELPER FUNCTION PROTOTYPE(s)*/
 void destroySchedule(League* league);
 bool generateRound(League* league, int* teamIndices, int startMatchday, bool swapHomeAway);
+static bool initStandings(League* league);
+static void freeStandings(League* league);
+static void applyMatchdayResults(League* league, const Match* matches, int numMatches);
+static void simulateFixture(void* context, int index);
+static bool initLeagueTable(League* league);
+static void freeLeagueTable(League* league);
+static void markStandingsChanged(League* league, int slot);
+static void resolveTiedGroups(League* league);
+static void resolveTiedGroup(League* league, int start, int count, int ruleIndex);
+static int tiebreakValue(const League* league, TiebreakRule rule, const int* group, int count, int slot);
 
 
 
@@ -64,16 +75,39 @@ League* createLeague(const char* name, const char* region, int maxTeams)
         free(league);
         return NULL;
     }
+    league -> nameIndex = getDefaultNameIndex();
+    initNameSlotMap(&league -> teamSlots);
 
     // Schedule
+    league -> fixtures = NULL;
+    league -> matchdayOffsets = NULL;
+    league -> numFixtures = 0;
     league -> schedule = NULL;
     league -> matchesPerMatchday = NULL;
     league -> numMatchdays = 0;
     league -> currentMatchday = 0;
     league -> scheduleGenerated = false;
+    initArena(&league -> arena, 0);
 
     // League table
-    league -> leagueTable = NULL;
+    league -> standings.numTeams = 0;
+    league -> standings.points = NULL;
+    league -> standings.headToHeadPoints = NULL;
+    league -> table.numTeams = 0;
+    league -> table.order = NULL;
+    league -> table.isDirty = NULL;
+    league -> table.keys = NULL;
+
+    // Tiebreak rules (goal difference, then goals scored)
+    league -> tiebreakRules[0] = TIEBREAK_GOAL_DIFFERENCE;
+    league -> tiebreakRules[1] = TIEBREAK_GOALS_SCORED;
+    league -> numTiebreakRules = 2;
+
+    // Seed the league's match streams from the default stream
+    league -> seed = randomNext(getDefaultRandomState());
+    league -> streamId = 0;
+    league -> matchEngine = MATCH_ENGINE_MINUTE;
+    league -> scheduler = NULL;
 
     return league;
 }
@@ -89,20 +123,15 @@ void destroyLeague(League* league)
 
     // Free teams array (but not the teams themselves, as they might be used elsewhere)
     free(league -> teams);
+    freeNameSlotMap(&league -> teamSlots);
 
-    // Free schedule if it exists
+    // Free schedule if it exists, along with the arena it lived in
     destroySchedule(league);
+    freeArena(&league -> arena);
 
-    // Free league table if it exists
-    if (league -> leagueTable != NULL)
-    {
-        // Free each team in the league table
-        for (int i = 0; i < league -> numTeams; i++)
-        {
-            free(league -> leagueTable[i]);
-        }
-        free(league -> leagueTable);
-    }
+    // Free the standings & league table if they exist
+    freeStandings(league);
+    freeLeagueTable(league);
 
     // Free the league
     free(league);
@@ -129,22 +158,29 @@ bool addTeamToLeague(League* league, Team* team)
         return false;
     }
 
-    // Check if team already exists in the league
-    for (int teamIndex = 0; teamIndex < league -> numTeams; teamIndex++)
-    {
-        // If we find two teams with the same name => same team
-        if (strcmp(league -> teams[teamIndex] -> name, team -> name) == 0)
-        {
-            fprintf(stderr, "Error: Team '%s' is already in the league.\n", 
-                    team -> name);
-            return false;
-        }
+    // Check if team already exists in the league (two teams with the same name => same team)
+    int nameId = internName(league -> nameIndex, team -> name);
+    if (nameId == -1) {
+        return false;
+    } else if (getNameSlot(&league -> teamSlots, nameId) != -1) {
+        fprintf(stderr, "Error: Team '%s' is already in the league.\n", 
+                team -> name);
+        return false;
     }
 
     // Add team to the league and increase our num teams counter
+    if (setNameSlot(&league -> teamSlots, nameId, league -> numTeams) == false)
+    {
+        return false;
+    }
     league -> teams[league -> numTeams] = team;
+    team -> leagueSlot = league -> numTeams;
     league -> numTeams++;
 
+    // Slots changed, standings & table get rebuilt from the teams' records
+    freeStandings(league);
+    freeLeagueTable(league);
+
     // If schedule was already generated, it's now invalid
     if (league -> scheduleGenerated == true)
     {
@@ -168,16 +204,8 @@ bool removeTeamFromLeague(League* league, const char* teamName)
     }
 
     // Find the team we want to remove
-    int teamIndex = -1;
-    for (int i = 0; i < league -> numTeams; i++)
-    {
-        // If we find a team with a matching name
-        if (strcmp(league -> teams[i] -> name, teamName) == 0)
-        {
-            teamIndex = i;
-            break;
-        }
-    }
+    int nameId = findNameId(league -> nameIndex, teamName);
+    int teamIndex = getNameSlot(&league -> teamSlots, nameId);
 
     // If we didn't find any teams with matching names
     if (teamIndex == -1)
@@ -188,13 +216,21 @@ bool removeTeamFromLeague(League* league, const char* teamName)
     }
 
     // Shift all teams left to fill the gap
+    league -> teams[teamIndex] -> leagueSlot = -1;
+    setNameSlot(&league -> teamSlots, nameId, -1);
     for (int i = teamIndex; i < league -> numTeams - 1; i++)
     {
         league -> teams[i] = league -> teams[i + 1];
+        league -> teams[i] -> leagueSlot = i;
+        setNameSlot(&league -> teamSlots, findNameId(league -> nameIndex, league -> teams[i] -> name), i);
     }
 
     league -> numTeams--;
 
+    // Slots changed, standings & table get rebuilt from the teams' records
+    freeStandings(league);
+    freeLeagueTable(league);
+
     // If schedule was already generated, it's now invalid
     if (league->scheduleGenerated)
     {
@@ -205,6 +241,120 @@ bool removeTeamFromLeague(League* league, const char* teamName)
     return true;
 }
 
+// Choose the name index the league interns its team names into
+bool setLeagueNameIndex(League* league, NameIndex* index)
+{
+    // NULL check league
+    if (league == NULL)
+    {
+        fprintf(stderr, "Error: Cannot set the name index of a NULL league.\n");
+        return false;
+    }
+
+    // Ids differ between indices, so map every team again
+    league -> nameIndex = (index != NULL) ? index : getDefaultNameIndex();
+    freeNameSlotMap(&league -> teamSlots);
+    for (int slot = 0; slot < league -> numTeams; slot++)
+    {
+        int nameId = internName(league -> nameIndex, league -> teams[slot] -> name);
+        if (nameId == -1 || setNameSlot(&league -> teamSlots, nameId, slot) == false)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Set the seed the league derives its match streams from
+void setLeagueSeed(League* league, uint64_t seed, int streamId)
+{
+    // NULL check league
+    if (league == NULL)
+    {
+        fprintf(stderr, "Error: Cannot set the seed of a NULL league.\n");
+        return;
+    }
+
+    league -> seed = seed;
+    league -> streamId = streamId;
+}
+
+// Choose the engine used to simulate the league's fixtures
+void setLeagueMatchEngine(League* league, MatchEngine engine)
+{
+    // NULL check league
+    if (league == NULL)
+    {
+        fprintf(stderr, "Error: Cannot set the match engine of a NULL league.\n");
+        return;
+    }
+
+    league -> matchEngine = engine;
+
+    // Apply to fixtures that were already scheduled
+    if (league -> scheduleGenerated == true)
+    {
+        for (int i = 0; i < league -> numFixtures; i++)
+        {
+            league -> fixtures[i].engine = engine;
+        }
+    }
+}
+
+// Choose a scheduler to simulate each matchday's fixtures on
+void setLeagueScheduler(League* league, Scheduler* scheduler)
+{
+    // NULL check league
+    if (league == NULL)
+    {
+        fprintf(stderr, "Error: Cannot set the scheduler of a NULL league.\n");
+        return;
+    }
+
+    league -> scheduler = scheduler;
+}
+
+// Choose the rules that separate teams level on points
+bool setLeagueTiebreakRules(League* league, const TiebreakRule* rules, int numRules)
+{
+    // Validate input
+    if (league == NULL) {
+        fprintf(stderr, "Error: Cannot set the tiebreak rules of a NULL league.\n");
+        return false;
+    } else if (numRules < 0 || numRules > MAX_TIEBREAK_RULES || (numRules > 0 && rules == NULL)) {
+        fprintf(stderr, "Error: Invalid tiebreak rules for %s.\n", league -> name);
+        return false;
+    }
+
+    for (int i = 0; i < numRules; i++)
+    {
+        if (rules[i] < 0 || rules[i] >= NUM_TIEBREAK_RULES)
+        {
+            fprintf(stderr, "Error: Unknown tiebreak rule %d for %s.\n", (int)rules[i], league -> name);
+            return false;
+        }
+    }
+
+    for (int i = 0; i < numRules; i++)
+    {
+        league -> tiebreakRules[i] = rules[i];
+    }
+    league -> numTiebreakRules = numRules;
+
+    // Re-rank the whole table under the new rules
+    if (league -> table.numTeams > 0)
+    {
+        for (int slot = 0; slot < league -> table.numTeams; slot++)
+        {
+            markStandingsChanged(league, slot);
+        }
+        updateLeagueTable(league);
+    }
+
+    return true;
+}
+
 // Generate a schedule for the league (each team plays each other twice)
 bool generateSchedule(League* league)
 {
@@ -238,8 +388,8 @@ bool generateSchedule(League* league)
     league -> numMatchdays = 2 * matchdaysPerRound; // Double round-robin
     league -> currentMatchday = 0;
 
-    // Allocate memory for the schedule & NULL check
-    league -> schedule = (Match***)malloc(league -> numMatchdays * sizeof(Match**));
+    // Allocate memory for the schedule from the league's arena & NULL check
+    league -> schedule = (Match***)arenaAlloc(&league -> arena, league -> numMatchdays * sizeof(Match**));
     if (league -> schedule == NULL)
     {
         fprintf(stderr, "Error: Failed to allocate memory for schedule.\n");
@@ -247,30 +397,39 @@ bool generateSchedule(League* league)
     }
 
     // Allocate memory for matches per matchday array & NULL check
-    league -> matchesPerMatchday = (int*)malloc(league -> numMatchdays * sizeof(int));
+    league -> matchesPerMatchday = (int*)arenaAlloc(&league -> arena, league -> numMatchdays * sizeof(int));
     if (league -> matchesPerMatchday == NULL)
     {
         fprintf(stderr, "Error: Failed to allocate memory for matchesPerMatchday.\n");
-        free(league -> schedule);
-        league -> schedule = NULL;
+        destroySchedule(league);
+        return false;
+    }
+
+    // Allocate the contiguous fixture list & the offset of each matchday into it
+    league -> numFixtures = league -> numMatchdays * (league -> numTeams / 2);
+    league -> fixtures = (Match*)arenaAlloc(&league -> arena, league -> numFixtures * sizeof(Match));
+    league -> matchdayOffsets = (int*)arenaAlloc(&league -> arena, (league -> numMatchdays + 1) * sizeof(int));
+    if (league -> fixtures == NULL || league -> matchdayOffsets == NULL)
+    {
+        fprintf(stderr, "Error: Failed to allocate memory for the fixtures of %s.\n", league -> name);
+        destroySchedule(league);
         return false;
     }
 
-    // Fill matchesPerMatchday
+    // Fill matchesPerMatchday & matchdayOffsets
     for (int i = 0; i < league -> numMatchdays; i++)
     {
         league -> matchesPerMatchday[i] = league -> numTeams / 2;
+        league -> matchdayOffsets[i] = i * (league -> numTeams / 2);
     }
+    league -> matchdayOffsets[league -> numMatchdays] = league -> numFixtures;
 
     // Create a temporary array of team indices for scheduling & NULL check
     int* teamIndices = (int*)malloc(league -> numTeams * sizeof(int));
     if (teamIndices == NULL)
     {
         fprintf(stderr, "Error: Failed to allocate memory for teamIndices.\n");
-        free(league -> schedule);
-        free(league -> matchesPerMatchday);
-        league -> schedule = NULL;
-        league -> matchesPerMatchday = NULL;
+        destroySchedule(league);
         return false;
     }
 
@@ -287,6 +446,7 @@ bool generateSchedule(League* league)
         fprintf(stderr, "Error: Encountered an error generating the first half of the season for %s\n", 
                 league -> name);
         free(teamIndices);
+        destroySchedule(league);
         return false;
     }
 
@@ -297,18 +457,62 @@ bool generateSchedule(League* league)
         fprintf(stderr, "Error: Encountered an error generating the second half of the season for %s\n", 
             league -> name);
         free(teamIndices);
+        destroySchedule(league);
         return false;
     }
     
     free(teamIndices);
     league -> scheduleGenerated = true;
 
-    // Initialize league table
+    // Initialize the standings (slots are the team indices the schedule was built with) & league table
+    if (initStandings(league) == false)
+    {
+        return false;
+    }
     updateLeagueTable(league);
 
     return true;
 }
 
+// Get the fixtures of a matchday
+Match* getMatchdayFixtures(const League* league, int matchday, int* numMatches)
+{
+    if (numMatches != NULL) { *numMatches = 0; }
+
+    // Validate input
+    if (league == NULL || league -> fixtures == NULL)
+    {
+        fprintf(stderr, "Error: Cannot get fixtures of a league without a schedule.\n");
+        return NULL;
+    } else if (matchday < 0 || matchday >= league -> numMatchdays) {
+        fprintf(stderr, "Error: Invalid matchday %d for %s.\n", matchday, league -> name);
+        return NULL;
+    }
+
+    if (numMatches != NULL)
+    {
+        *numMatches = league -> matchdayOffsets[matchday + 1] - league -> matchdayOffsets[matchday];
+    }
+
+    return &league -> fixtures[league -> matchdayOffsets[matchday]];
+}
+
+// Get a single fixture of the league
+Match* getLeagueMatch(const League* league, int matchday, int matchIndex)
+{
+    int numMatches = 0;
+    Match* matches = getMatchdayFixtures(league, matchday, &numMatches);
+    if (matches == NULL) { return NULL; }
+
+    if (matchIndex < 0 || matchIndex >= numMatches)
+    {
+        fprintf(stderr, "Error: Invalid match %d on matchday %d.\n", matchIndex, matchday);
+        return NULL;
+    }
+
+    return &matches[matchIndex];
+}
+
 // Simulate the next matchday in the league
 bool simulateMatchday(League* league)
 {
@@ -337,28 +541,25 @@ bool simulateMatchday(League* league)
     // fprintf(stdout, "Simulating Matchday %d of %s...\n", 
     //         league -> currentMatchday + 1, league -> name);
 
-    // Simulate all matches for the current matchday
-    for (int i = 0; i < league -> matchesPerMatchday[league -> currentMatchday]; i++)
+    // Report matches that were already played, they are skipped
+    int numMatches = 0;
+    Match* matches = getMatchdayFixtures(league, league -> currentMatchday, &numMatches);
+    for (int i = 0; i < numMatches; i++)
     {
-        // Get a match from the matchday schedule
-        Match* match = league -> schedule[league -> currentMatchday][i];
-        
-        // Skip already played matches
-        if (match -> isCompleted == true) 
+        if (matches[i].isCompleted == true) 
         {
             printf("Match between %s and %s was already played.\n", 
-                    match -> homeTeam -> name, match -> awayTeam -> name);
-            continue;
+                    matches[i].homeTeam -> name, matches[i].awayTeam -> name);
         }
-        
-        // Simulate the match
-        simulateMatch(match);
-        
-        // // Print the result
-        // printf("  ");
-        // printMatchResult(match);
     }
 
+    // Simulate all matches for the current matchday, forked onto the league's
+    // scheduler if it has one (no two fixtures of a matchday share a team)
+    runScheduler(league -> scheduler, simulateFixture, league, numMatches);
+
+    // Merge the matchday's results into the standings, in fixture order
+    applyMatchdayResults(league, matches, numMatches);
+
     // Advance to next matchday
     league -> currentMatchday++;
 
@@ -383,12 +584,33 @@ void simulateSeason(League* league)
     fprintf(stdout, "Simulating entire season for %s...\n",
             league -> name);
 
-    // Reset current matchday if needed
     if (league -> currentMatchday > 0)
     {
         fprintf(stdout, "Resetting league to start of season for %s.\n", 
                 league -> name);
-        
+    }
+
+    playSeason(league);
+
+    fprintf(stdout, "\n%s Season complete! Final standings:\n", league->name);
+    printLeagueTable(league);
+}
+
+// Function to simulate the entire season without printing anything
+bool playSeason(League* league)
+{
+    // Validate input
+    if (league == NULL) {
+        fprintf(stderr, "Error: Cannot simulate season for NULL league.\n");
+        return false;
+    } else if (league -> scheduleGenerated == false) {
+        fprintf(stderr, "Error: Cannot simulate season without a generated schedule.\n");
+        return false;
+    }
+
+    // Reset current matchday if needed
+    if (league -> currentMatchday > 0)
+    {
         // Reset all teams' stats
         for (int i = 0; i < league -> numTeams; i++)
         {
@@ -401,24 +623,12 @@ void simulateSeason(League* league)
             team -> goalDifferential = 0;
             team -> points = 0;
         }
+        initStandings(league);
         
         // Reset all matches
-        for (int i = 0; i < league->numMatchdays; i++)
+        for (int i = 0; i < league -> numFixtures; i++)
         {
-            for (int j = 0; j < league->matchesPerMatchday[i]; j++)
-            {
-                Match* match = league->schedule[i][j];
-                match -> isCompleted = false;
-                match -> homeScore = 0;
-                match -> awayScore = 0;
-                match -> numScorers = 0;
-                free(match -> scorers);
-                free(match -> scorerTeamIndices);
-                free(match -> scoringMinutes);
-                match -> scorers = NULL;
-                match -> scorerTeamIndices = NULL;
-                match -> scoringMinutes = NULL;
-            }
+            resetMatch(&league -> fixtures[i]);
         }
         
         league -> currentMatchday = 0;
@@ -427,19 +637,13 @@ void simulateSeason(League* league)
     // Simulate each matchday
     while (league -> currentMatchday < league -> numMatchdays)
     {
-        simulateMatchday(league);
-        
-        // Print current standings after each matchday
-        // fprintf(stdout, "\nStandings after Matchday %d:\n", league -> currentMatchday);
-        // printLeagueTable(league);
-        // fprintf(stdout, "\n");
+        if (simulateMatchday(league) == false) { return false; }
     }
 
-    fprintf(stdout, "\n%s Season complete! Final standings:\n", league->name);
-    printLeagueTable(league);
+    return true;
 }
 
-// Update the league table based on team records
+// Update the league table based on the standings
 void updateLeagueTable(League* league)
 {
     // Validate input
@@ -451,94 +655,109 @@ void updateLeagueTable(League* league)
                 league -> name);
         return;
     }
-    
-    // Initialize or clear the league table
-    if (league -> leagueTable == NULL)
+
+    // Standings are normally set up with the schedule, take them from the teams otherwise
+    if (league -> standings.numTeams != league -> numTeams && initStandings(league) == false)
+    {
+        return;
+    }
+
+    // Initialize the league table (every team starts out changed)
+    if (league -> table.numTeams != league -> numTeams && initLeagueTable(league) == false)
     {
-        // Allocate memory for the leage & NULL check
-        league -> leagueTable = (int**)malloc(league -> numTeams * sizeof(int*));
-        if (league -> leagueTable == NULL)
+        return;
+    }
+
+    LeagueTable* table = &league -> table;
+    if (table -> numDirty == 0) { return; }
+
+    // Pack every team's standings into a ranking key (as many of the tiebreak rules
+    // as fit), ties going to whoever was higher before
+    for (int slot = 0; slot < table -> numTeams; slot++)
+    {
+        table -> keys[slot] = getRankingKey(league, slot, league -> standings.points[slot],
+                                            league -> standings.goalDifference[slot],
+                                            league -> standings.goalsFor[slot]);
+    }
+
+    // When most of the table changed (i.e. every team played this matchday) radix
+    // sort it all at once, otherwise reposition only the changed teams
+    if (2 * table -> numDirty <= table -> numTeams
+        || rankStandingsBatch(table -> keys, 1, table -> numTeams, table -> order) == false)
+    {
+        // Take the changed teams out, the rest are still in order relative to each other
+        int numRanked = 0;
+        for (int i = 0; i < table -> numTeams; i++)
         {
-            fprintf(stderr, "Error: Failed to allocate memory for league table.\n");
-            return;
+            int slot = table -> order[i];
+            if (table -> isDirty[slot] == false) { table -> order[numRanked++] = slot; }
         }
-        
-        // Fill league table
-        for (int i = 0; i < league -> numTeams; i++)
+
+        // Put each changed team back in right after the last team that ranks above it
+        for (int i = 0; i < table -> numDirty; i++)
         {
-            // Allocate memory for an entry in the league table & NULL check
-            league -> leagueTable[i] = (int*)malloc(2 * sizeof(int));
-            if (league -> leagueTable[i] == NULL)
+            int slot = table -> dirtySlots[i];
+
+            int low = 0;
+            int high = numRanked;
+            while (low < high)
             {
-                fprintf(stderr, "Error: Failed to allocate memory for league table entry.\n");
-                // Clean up
-                for (int j = 0; j < i; j++)
-                {
-                    free(league -> leagueTable[j]);
+                int middle = low + (high - low) / 2;
+                if (table -> keys[table -> order[middle]] > table -> keys[slot]) {
+                    low = middle + 1;
+                } else {
+                    high = middle;
                 }
-                free(league -> leagueTable);
-                league -> leagueTable = NULL;
-                return;
             }
 
-            league -> leagueTable[i][0] = i;        // Team index
-            league -> leagueTable[i][1] = 0;        // Points
+            memmove(&table -> order[low + 1], &table -> order[low], (numRanked - low) * sizeof(int));
+            table -> order[low] = slot;
+            numRanked++;
         }
     }
 
-    // Update points in the table for each table
-    for (int i = 0; i < league -> numTeams; i++)
+    // Rules the keys can't hold (i.e. head-to-head) depend on who else is tied, so
+    // every group of teams level on points is resolved again
+    if (getPackedTiebreakRules(league) < league -> numTiebreakRules)
     {
-        Team* team = league -> teams[league -> leagueTable[i][0]];
-        league -> leagueTable[i][1] = team -> points;
+        resolveTiedGroups(league);
     }
 
-    // Using a simple bubble sort for clarity, can be optimized
-    for (int i = 0; i < league->numTeams - 1; i++) {
-        for (int j = 0; j < league->numTeams - i - 1; j++) {
-            Team* teamA = league->teams[league->leagueTable[j][0]];
-            Team* teamB = league->teams[league->leagueTable[j+1][0]];
-            
-            // Primary sort by points (descending)
-            if (teamA->points < teamB->points)
-            {
-                // Swap
-                int tempIdx = league->leagueTable[j][0];
-                int tempPoints = league->leagueTable[j][1];
-                league->leagueTable[j][0] = league->leagueTable[j+1][0];
-                league->leagueTable[j][1] = league->leagueTable[j+1][1];
-                league->leagueTable[j+1][0] = tempIdx;
-                league->leagueTable[j+1][1] = tempPoints;
-            }
+    // Rebuild the inverse index & clear the changes
+    for (int i = 0; i < table -> numTeams; i++)
+    {
+        table -> position[table -> order[i]] = i;
+    }
+    for (int i = 0; i < table -> numDirty; i++)
+    {
+        table -> isDirty[table -> dirtySlots[i]] = false;
+    }
+    table -> numDirty = 0;
+}
 
-            // If points are equal, sort by goal difference (descending)
-            else if (teamA->points == teamB->points && 
-                    teamA->goalDifferential < teamB->goalDifferential)
-            {
-                // Swap
-                int tempIdx = league->leagueTable[j][0];
-                int tempPoints = league->leagueTable[j][1];
-                league->leagueTable[j][0] = league->leagueTable[j+1][0];
-                league->leagueTable[j][1] = league->leagueTable[j+1][1];
-                league->leagueTable[j+1][0] = tempIdx;
-                league->leagueTable[j+1][1] = tempPoints;
-            }
+// Get a team's ranking key: points, then goal difference & goals scored if the
+// tiebreak rules start with them, then whoever is higher in the table now
+uint64_t getRankingKey(const League* league, int slot, int points, int goalDifference, int goalsScored)
+{
+    int numPacked = getPackedTiebreakRules(league);
 
-            // If points and goal difference are equal, sort by goals scored (descending)
-            else if (teamA->points == teamB->points && 
-                    teamA->goalDifferential == teamB->goalDifferential &&
-                    teamA->goalsScored < teamB->goalsScored)
-            {
-                // Swap
-                int tempIdx = league->leagueTable[j][0];
-                int tempPoints = league->leagueTable[j][1];
-                league->leagueTable[j][0] = league->leagueTable[j+1][0];
-                league->leagueTable[j][1] = league->leagueTable[j+1][1];
-                league->leagueTable[j+1][0] = tempIdx;
-                league->leagueTable[j+1][1] = tempPoints;
-            }
-        }
+    return packStandingsKey(points,
+                            (numPacked > 0) ? goalDifference : 0,
+                            (numPacked > 1) ? goalsScored : 0,
+                            STANDINGS_KEY_FIELD_MAX - league -> table.position[slot]);
+}
+
+// Count how many of the league's leading tiebreak rules the ranking keys hold
+// (goal difference, then goals scored)
+int getPackedTiebreakRules(const League* league)
+{
+    if (league == NULL || league -> numTiebreakRules == 0 || league -> tiebreakRules[0] != TIEBREAK_GOAL_DIFFERENCE) {
+        return 0;
+    } else if (league -> numTiebreakRules == 1 || league -> tiebreakRules[1] != TIEBREAK_GOALS_SCORED) {
+        return 1;
     }
+
+    return 2;
 }
 
 // Get a team from the league by name
@@ -553,17 +772,21 @@ Team* getTeamByName(const League* league, const char* name)
         return NULL;
     }
     
-    // Search the league for teams with the specified name
-    for (int i = 0; i < league -> numTeams; i++)
+    return getTeamByNameId(league, findNameId(league -> nameIndex, name));
+}
+
+// Get a team from the league by the id of its name
+Team* getTeamByNameId(const League* league, int nameId)
+{
+    // NULL check league
+    if (league == NULL)
     {
-        // If we find teams with matching names
-        if (strcmp(league -> teams[i] -> name, name) == 0)
-        {
-            return league -> teams[i];
-        }
+        fprintf(stderr, "Error: Cannot find a team in a NULL league.\n");
+        return NULL;
     }
 
-    return NULL;
+    int slot = getNameSlot(&league -> teamSlots, nameId);
+    return (slot != -1) ? league -> teams[slot] : NULL;
 }
 
 // Get a team's position in the league table
@@ -577,24 +800,39 @@ int getTeamPosition(const League* league, const Team* team)
         fprintf(stderr, "Error: Cannot search %s for a NULL team.\n", 
                 league -> name);
         return -1;
-    } else if (league -> leagueTable == NULL) {
+    } else if (league -> table.numTeams != league -> numTeams) {
         fprintf(stderr, "Error: Cannot search a NULL league table.\n");
         return -1;
     }
-    
-    // Search for the position of the specified team
-    for (int i = 0; i < league->numTeams; i++)
+
+    // Make sure the team is actually in this league
+    int slot = team -> leagueSlot;
+    if (slot < 0 || slot >= league -> numTeams || league -> teams[slot] != team)
     {
-        // If we find a team with the same team index in the table as the specified team...
-        if (league->teams[league->leagueTable[i][0]] == team)
-        {
-            // Position is 1-based
-            return i + 1;
-        }
+        return -1;
     }
 
-    // Team not found
-    return -1;
+    // Position is 1-based
+    return league -> table.position[slot] + 1;
+}
+
+// Get the team at a position in the league table
+Team* getTeamAtPosition(const League* league, int position)
+{
+    // Validate input
+    if (league == NULL) {
+        fprintf(stderr, "Error: Cannot get a team from a NULL league.\n");
+        return NULL;
+    } else if (league -> table.numTeams != league -> numTeams) {
+        fprintf(stderr, "Error: Cannot search a NULL league table.\n");
+        return NULL;
+    } else if (position < 1 || position > league -> numTeams) {
+        fprintf(stderr, "Error: Invalid position %d in %s.\n", position, league -> name);
+        return NULL;
+    }
+
+    // Position is 1-based
+    return league -> teams[league -> table.order[position - 1]];
 }
 
 // Print the league table (standings)
@@ -604,10 +842,10 @@ void printLeagueTable(League* league)
     if (league == NULL) {
         fprintf(stderr, "Error: Cannot print table for NULL league.\n");
         return;
-    } else if (league -> leagueTable == NULL) {
+    } else if (league -> table.numTeams != league -> numTeams) {
         updateLeagueTable(league);
 
-        if (league -> leagueTable == NULL) {
+        if (league -> table.numTeams != league -> numTeams) {
             fprintf(stderr, "Error: Failed to create league table.\n");
             return;
         }
@@ -619,20 +857,21 @@ void printLeagueTable(League* league)
     fprintf(stdout, "----------------------------------------------------------\n");
 
     // Print table contents
+    const LeagueStandings* standings = &league -> standings;
     for (int i = 0; i < league -> numTeams; i++)
     {
-        Team* team = league -> teams[league -> leagueTable[i][0]];
-        int gamesPlayed = team -> wins + team -> draws + team -> losses;
+        int slot = league -> table.order[i];
+        int gamesPlayed = standings -> wins[slot] + standings -> draws[slot] + standings -> losses[slot];
         
         fprintf(stdout, "%-4d %-20s %-5d %-5d %-5d %-5d %-5d %-5d\n", 
                 i + 1, 
-                team -> name, 
-                team -> points, 
+                league -> teams[slot] -> name, 
+                standings -> points[slot], 
                 gamesPlayed, 
-                team -> wins, 
-                team -> draws, 
-                team -> losses, 
-                team -> goalDifferential);
+                standings -> wins[slot], 
+                standings -> draws[slot], 
+                standings -> losses[slot], 
+                standings -> goalDifference[slot]);
     }
 }
 
@@ -756,25 +995,30 @@ void printMatchdayResults(const League* league, int matchday)
 
 /* HELER FUNCTIONS */
 
+// Helper function to simulate one fixture of the current matchday, with its own
+// (seed, league, matchday, match) stream (a scheduler task)
+static void simulateFixture(void* context, int index)
+{
+    League* league = (League*)context;
+    Match* match = &league -> fixtures[league -> matchdayOffsets[league -> currentMatchday] + index];
+    if (match -> isCompleted == true) { return; }
+
+    RandomState matchRng;
+    deriveRandomState(&matchRng, league -> seed, (uint32_t)league -> streamId, 
+                        (uint32_t)league -> currentMatchday, (uint32_t)index);
+    simulateMatch(match, &matchRng);
+}
+
 // Helper function to free/clean up the schedule of a league
 void destroySchedule(League* league)
 {
-    // Look at each matchday
-    for (int matchday = 0; matchday < league -> numMatchdays; matchday++)
-    {
-        // If there is a game (or more) on that day
-        if (league -> schedule[matchday] != NULL)
-        {
-            // Look at each match during that matchday
-            for (int match = 0; match < league -> matchesPerMatchday[matchday]; match++)
-            {
-                destroyMatch(league -> schedule[matchday][match]);
-            }
-            free(league -> schedule[matchday]);
-        }
-    }
-    free(league -> schedule);
-    free(league -> matchesPerMatchday);
+    // Every matchday, match & spilled goal came from the arena, release them all at once
+    resetArena(&league -> arena);
+    league -> fixtures = NULL;
+    league -> matchdayOffsets = NULL;
+    league -> numFixtures = 0;
+    league -> schedule = NULL;
+    league -> matchesPerMatchday = NULL;
 }
 
 // Helper function to generate a round of a round-robin tournament
@@ -788,7 +1032,7 @@ bool generateRound(League* league, int* teamIndices, int startMatchday, bool swa
         int currentMatchday = startMatchday + matchday;
 
         // Allocate memory for matches on this matchday
-        league -> schedule[currentMatchday] = (Match**)malloc(league -> matchesPerMatchday[currentMatchday] * sizeof(Match*));
+        league -> schedule[currentMatchday] = (Match**)arenaAlloc(&league -> arena, league -> matchesPerMatchday[currentMatchday] * sizeof(Match*));
         if (league->schedule[currentMatchday] == NULL)
         {
             fprintf(stderr, "Error: Failed to allocate memory for matchday %d.\n", currentMatchday);
@@ -813,15 +1057,18 @@ bool generateRound(League* league, int* teamIndices, int startMatchday, bool swa
             char dateStr[20];
             sprintf(dateStr, "MD%d", currentMatchday + 1);
 
-            // Create the new match
-            Match* match = createMatch(league -> teams[homeIdx], league -> teams[awayIdx], dateStr);
-            if (match == NULL)
+            // Create the new match in its slot of the fixture list
+            Match* match = &league -> fixtures[league -> matchdayOffsets[currentMatchday] + i];
+            if (initMatchInArena(match, &league -> arena, league -> teams[homeIdx], league -> teams[awayIdx], dateStr) == false)
             {
                 fprintf(stderr, "Error: Failed to create match for matchday %d.\n", currentMatchday);
                 return false;
             }
 
             // Add new match to the schedule
+            match -> homeSlot = homeIdx;
+            match -> awaySlot = awayIdx;
+            match -> engine = league -> matchEngine;
             league->schedule[currentMatchday][i] = match;
         }
 
@@ -835,4 +1082,294 @@ bool generateRound(League* league, int* teamIndices, int startMatchday, bool swa
     }
 
     return true;
-}
\ No newline at end of file
+}
+
+// Helper function to (re)build the standings columns from the teams' records
+static bool initStandings(League* league)
+{
+    LeagueStandings* standings = &league -> standings;
+
+    // One block for every column, reallocated only when the number of teams changed
+    if (standings -> numTeams != league -> numTeams)
+    {
+        freeStandings(league);
+
+        int* columns = (int*)malloc(7 * league -> numTeams * sizeof(int));
+        int* matrices = (int*)malloc(3 * league -> numTeams * league -> numTeams * sizeof(int));
+        if (columns == NULL || matrices == NULL)
+        {
+            fprintf(stderr, "Error: Failed to allocate memory for the standings of %s.\n", 
+                    league -> name);
+            free(columns);
+            free(matrices);
+            return false;
+        }
+
+        standings -> points = columns;
+        standings -> goalDifference = columns + league -> numTeams;
+        standings -> goalsFor = columns + 2 * league -> numTeams;
+        standings -> goalsAgainst = columns + 3 * league -> numTeams;
+        standings -> wins = columns + 4 * league -> numTeams;
+        standings -> draws = columns + 5 * league -> numTeams;
+        standings -> losses = columns + 6 * league -> numTeams;
+        standings -> headToHeadPoints = matrices;
+        standings -> headToHeadGoals = matrices + league -> numTeams * league -> numTeams;
+        standings -> headToHeadAwayGoals = matrices + 2 * league -> numTeams * league -> numTeams;
+        standings -> numTeams = league -> numTeams;
+    }
+
+    // Teams don't keep their results against each other, so head-to-head starts empty
+    memset(standings -> headToHeadPoints, 0, 3 * league -> numTeams * league -> numTeams * sizeof(int));
+
+    // Start from whatever the teams' records currently are
+    for (int slot = 0; slot < league -> numTeams; slot++)
+    {
+        const Team* team = league -> teams[slot];
+        standings -> points[slot] = team -> points;
+        standings -> goalDifference[slot] = team -> goalDifferential;
+        standings -> goalsFor[slot] = team -> goalsScored;
+        standings -> goalsAgainst[slot] = team -> goalsConceded;
+        standings -> wins[slot] = team -> wins;
+        standings -> draws[slot] = team -> draws;
+        standings -> losses[slot] = team -> losses;
+        markStandingsChanged(league, slot);
+    }
+
+    return true;
+}
+
+// Helper function to free the standings columns
+static void freeStandings(League* league)
+{
+    // Every column lives in the block the points column starts, every matrix in
+    // the block the head-to-head points start
+    free(league -> standings.points);
+    free(league -> standings.headToHeadPoints);
+    league -> standings.points = NULL;
+    league -> standings.headToHeadPoints = NULL;
+    league -> standings.numTeams = 0;
+}
+
+// Helper function to merge a matchday's completed results into the standings
+static void applyMatchdayResults(League* league, const Match* matches, int numMatches)
+{
+    LeagueStandings* standings = &league -> standings;
+
+    // Scatter each result into its two teams' columns (no branches on the outcome)
+    for (int i = 0; i < numMatches; i++)
+    {
+        const Match* match = &matches[i];
+        if (match -> isCompleted == false || match -> homeSlot < 0 || match -> awaySlot < 0) { continue; }
+
+        int home = match -> homeSlot;
+        int away = match -> awaySlot;
+        int homeWin = match -> homeScore > match -> awayScore;
+        int awayWin = match -> homeScore < match -> awayScore;
+        int draw = match -> homeScore == match -> awayScore;
+
+        standings -> goalsFor[home] += match -> homeScore;
+        standings -> goalsAgainst[home] += match -> awayScore;
+        standings -> goalsFor[away] += match -> awayScore;
+        standings -> goalsAgainst[away] += match -> homeScore;
+
+        standings -> wins[home] += homeWin;
+        standings -> draws[home] += draw;
+        standings -> losses[home] += awayWin;
+        standings -> wins[away] += awayWin;
+        standings -> draws[away] += draw;
+        standings -> losses[away] += homeWin;
+
+        // Head-to-head, kept as matches complete so tied groups never rescan the schedule
+        int numTeams = standings -> numTeams;
+        standings -> headToHeadPoints[home * numTeams + away] += 3 * homeWin + draw;
+        standings -> headToHeadPoints[away * numTeams + home] += 3 * awayWin + draw;
+        standings -> headToHeadGoals[home * numTeams + away] += match -> homeScore;
+        standings -> headToHeadGoals[away * numTeams + home] += match -> awayScore;
+        standings -> headToHeadAwayGoals[away * numTeams + home] += match -> awayScore;
+
+        // Both teams may have to move in the table
+        markStandingsChanged(league, home);
+        markStandingsChanged(league, away);
+    }
+
+    // Derived columns, a straight pass over every slot
+    for (int slot = 0; slot < standings -> numTeams; slot++)
+    {
+        standings -> goalDifference[slot] = standings -> goalsFor[slot] - standings -> goalsAgainst[slot];
+        standings -> points[slot] = 3 * standings -> wins[slot] + standings -> draws[slot];
+    }
+}
+
+// Helper function to allocate the league table, starting in slot order with every team changed
+static bool initLeagueTable(League* league)
+{
+    freeLeagueTable(league);
+
+    LeagueTable* table = &league -> table;
+    int numTeams = league -> numTeams;
+
+    // One block for the int arrays, another for the flags
+    int* arrays = (int*)malloc(4 * numTeams * sizeof(int));
+    bool* isDirty = (bool*)malloc(numTeams * sizeof(bool));
+    uint64_t* keys = (uint64_t*)malloc(numTeams * sizeof(uint64_t));
+    if (arrays == NULL || isDirty == NULL || keys == NULL)
+    {
+        fprintf(stderr, "Error: Failed to allocate memory for league table.\n");
+        free(arrays);
+        free(isDirty);
+        free(keys);
+        return false;
+    }
+
+    table -> order = arrays;
+    table -> position = arrays + numTeams;
+    table -> dirtySlots = arrays + 2 * numTeams;
+    table -> tiebreakValues = arrays + 3 * numTeams;
+    table -> isDirty = isDirty;
+    table -> keys = keys;
+    table -> numTeams = numTeams;
+    table -> numDirty = 0;
+
+    for (int slot = 0; slot < numTeams; slot++)
+    {
+        table -> order[slot] = slot;
+        table -> position[slot] = slot;
+        table -> isDirty[slot] = false;
+        markStandingsChanged(league, slot);
+    }
+
+    return true;
+}
+
+// Helper function to free the league table
+static void freeLeagueTable(League* league)
+{
+    // Every int array lives in the block the order array starts
+    free(league -> table.order);
+    free(league -> table.isDirty);
+    free(league -> table.keys);
+    league -> table.order = NULL;
+    league -> table.isDirty = NULL;
+    league -> table.keys = NULL;
+    league -> table.numTeams = 0;
+    league -> table.numDirty = 0;
+}
+
+// Helper function to note that a team's standings changed, so the table repositions it
+static void markStandingsChanged(League* league, int slot)
+{
+    LeagueTable* table = &league -> table;
+    if (slot < 0 || slot >= table -> numTeams || table -> isDirty[slot] == true) { return; }
+
+    table -> isDirty[slot] = true;
+    table -> dirtySlots[table -> numDirty++] = slot;
+}
+
+// Helper function to resolve every group of teams level on points with the tiebreak rules
+static void resolveTiedGroups(League* league)
+{
+    const LeagueStandings* standings = &league -> standings;
+    const int* order = league -> table.order;
+
+    for (int start = 0; start < league -> table.numTeams; )
+    {
+        int end = start + 1;
+        while (end < league -> table.numTeams && standings -> points[order[end]] == standings -> points[order[start]])
+        {
+            end++;
+        }
+
+        resolveTiedGroup(league, start, end - start, 0);
+        start = end;
+    }
+}
+
+// Helper function to order a tied group of the table (count teams from start)
+// by a tiebreak rule, then split whoever is still level with the next rule
+static void resolveTiedGroup(League* league, int start, int count, int ruleIndex)
+{
+    if (count < 2 || ruleIndex >= league -> numTiebreakRules) { return; }
+
+    int* group = &league -> table.order[start];
+    int* values = &league -> table.tiebreakValues[start];
+    TiebreakRule rule = league -> tiebreakRules[ruleIndex];
+
+    for (int i = 0; i < count; i++)
+    {
+        values[i] = tiebreakValue(league, rule, group, count, group[i]);
+    }
+
+    // Stable insertion sort (groups are small), highest value first
+    for (int i = 1; i < count; i++)
+    {
+        int slot = group[i];
+        int value = values[i];
+        int j = i - 1;
+        while (j >= 0 && values[j] < value)
+        {
+            group[j + 1] = group[j];
+            values[j + 1] = values[j];
+            j--;
+        }
+        group[j + 1] = slot;
+        values[j + 1] = value;
+    }
+
+    // Teams still level go on to the next rule, head-to-head only among themselves
+    for (int i = 0; i < count; )
+    {
+        int end = i + 1;
+        while (end < count && values[end] == values[i]) { end++; }
+
+        resolveTiedGroup(league, start + i, end - i, ruleIndex + 1);
+        i = end;
+    }
+}
+
+// Helper function to get a team's value for a tiebreak rule (higher is better),
+// head-to-head rules summing the matrices over the other teams of its group
+static int tiebreakValue(const League* league, TiebreakRule rule, const int* group, int count, int slot)
+{
+    const LeagueStandings* standings = &league -> standings;
+    int numTeams = standings -> numTeams;
+    const int* row = NULL;
+    int value = 0;
+
+    switch (rule)
+    {
+        case TIEBREAK_GOAL_DIFFERENCE:
+            return standings -> goalDifference[slot];
+        case TIEBREAK_GOALS_SCORED:
+            return standings -> goalsFor[slot];
+        case TIEBREAK_WINS:
+            return standings -> wins[slot];
+        case TIEBREAK_AWAY_GOALS:
+            row = &standings -> headToHeadAwayGoals[slot * numTeams];
+            for (int opponent = 0; opponent < numTeams; opponent++) { value += row[opponent]; }
+            return value;
+        case TIEBREAK_HEAD_TO_HEAD_POINTS:
+            row = &standings -> headToHeadPoints[slot * numTeams];
+            break;
+        case TIEBREAK_HEAD_TO_HEAD_GOALS_SCORED:
+        case TIEBREAK_HEAD_TO_HEAD_GOAL_DIFFERENCE:
+            row = &standings -> headToHeadGoals[slot * numTeams];
+            break;
+        case TIEBREAK_HEAD_TO_HEAD_AWAY_GOALS:
+            row = &standings -> headToHeadAwayGoals[slot * numTeams];
+            break;
+        default:
+            return 0;
+    }
+
+    // Mini-table of the group, straight from the matrices
+    for (int i = 0; i < count; i++)
+    {
+        value += row[group[i]];
+        if (rule == TIEBREAK_HEAD_TO_HEAD_GOAL_DIFFERENCE)
+        {
+            value -= standings -> headToHeadGoals[group[i] * numTeams + slot];
+        }
+    }
+
+    return value;
+}
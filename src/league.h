@@ -11,16 +11,77 @@
 #include "team.h"
 #include "match.h"
 #include "modules/match_simulation.h"
+#include "random_utils.h"
+#include "arena.h"
+#include "name_index.h"
+#include "scheduler.h"
 #include <stdbool.h>
 
 #define MAX_LEAGUE_NAME_LENGTH 50
 #define MAX_REGION_LENGTH 50
+#define MAX_TIEBREAK_RULES 8
 
 
 
 
 /* FUNCTION PROTOTYPES */
 
+/**
+ * TiebreakRule @enum rules that separate teams level on points, applied in the
+ * order they are listed in the league. Head-to-head rules only count the
+ * matches played between the teams still tied (their mini-table).
+ */
+typedef enum {
+    TIEBREAK_GOAL_DIFFERENCE,               // Overall goal difference
+    TIEBREAK_GOALS_SCORED,                  // Overall goals scored
+    TIEBREAK_AWAY_GOALS,                    // Overall goals scored away from home
+    TIEBREAK_WINS,                          // Overall games won
+    TIEBREAK_HEAD_TO_HEAD_POINTS,           // Points in the matches between the tied teams
+    TIEBREAK_HEAD_TO_HEAD_GOAL_DIFFERENCE,  // Goal difference in the matches between the tied teams
+    TIEBREAK_HEAD_TO_HEAD_GOALS_SCORED,     // Goals scored in the matches between the tied teams
+    TIEBREAK_HEAD_TO_HEAD_AWAY_GOALS,       // Away goals scored in the matches between the tied teams
+    NUM_TIEBREAK_RULES
+} TiebreakRule;
+
+/**
+ * LeagueStandings @struct holding the league's standings as parallel columns
+ * indexed by team slot (the team's index in league -> teams). Results are
+ * applied & teams ranked with passes over these few dense arrays instead of
+ * going through each (mostly cold) Team struct.
+ */
+typedef struct {
+    int* points;                            // Points (3 for win, 1 for draw)
+    int* goalDifference;                    // Result of (goalsFor - goalsAgainst)
+    int* goalsFor;                          // Total scored on opposing teams
+    int* goalsAgainst;                      // Total allowed by opposing teams
+    int* wins;                              // Games won
+    int* draws;                             // Games drawn
+    int* losses;                            // Games lost
+
+    // Head-to-head matrices, [a * numTeams + b] => team slot a against team slot b
+    int* headToHeadPoints;                  // Points a took from its matches against b
+    int* headToHeadGoals;                   // Goals a scored against b
+    int* headToHeadAwayGoals;               // Goals a scored against b away from home
+    int numTeams;                           // Number of slots in each column (0 => not allocated)
+} LeagueStandings;
+
+/**
+ * LeagueTable @struct ranking of the league's teams. Instead of being sorted
+ * from scratch, it is kept in order incrementally: only teams whose standings
+ * changed are taken out & put back in with binary insertion (or, when most of
+ * the table changed, it is re-ranked at once with the standings radix sort).
+ */
+typedef struct {
+    int* order;                             // Slot of the team at each position (0 => top of the table)
+    int* position;                          // Position of each slot (inverse of order)
+    int* dirtySlots;                        // Slots whose standings changed since the table was last updated
+    bool* isDirty;                          // Whether each slot is in dirtySlots
+    uint64_t* keys;                         // Packed ranking key of each slot (see packStandingsKey())
+    int* tiebreakValues;                    // Scratch values (parallel to order) while resolving tied groups
+    int numDirty;                           // Number of slots in dirtySlots
+    int numTeams;                           // Number of slots in each array (0 => not allocated)
+} LeagueTable;
+
 typedef struct {
     // Name & Region
     char name[MAX_LEAGUE_NAME_LENGTH];      // Name of the league
@@ -30,16 +91,31 @@ typedef struct {
     Team** teams;                           // Array of teams in the league
     int numTeams;                           // Number of teams in the league
     int maxTeams;                           // Maximum number of teams allowed
+    NameIndex* nameIndex;                   // Index the team names are interned into (shareable between leagues)
+    NameSlotMap teamSlots;                  // Slot of each team by its name id in nameIndex
 
     // Schedule
-    Match*** schedule;                      // 2D array: [matchday][match]
+    Match* fixtures;                        // Every match of the season, stored contiguously matchday by matchday
+    int* matchdayOffsets;                   // Index in fixtures of each matchday's first match (numMatchdays + 1 entries)
+    int numFixtures;                        // Total number of matches in the season
+    Match*** schedule;                      // 2D array: [matchday][match], pointers into fixtures (kept for compatibility)
     int* matchesPerMatchday;                // Number of matches for each matchday
     int numMatchdays;                       // Number of matchdays in the season
     int currentMatchday;                    // Current matchday (0-based)
     bool scheduleGenerated;                 // Flag if schedule has been generated
+    Arena arena;                            // Memory for the schedule, its matches & their goals (released all at once)
 
     // League table
-    int** leagueTable;                      // Sorted indices of teams by rank
+    LeagueStandings standings;              // Standings columns, kept in sync with the teams' records
+    LeagueTable table;                      // Teams ranked by their standings
+    TiebreakRule tiebreakRules[MAX_TIEBREAK_RULES]; // Rules separating teams level on points, in order
+    int numTiebreakRules;                   // Number of rules in tiebreakRules
+
+    // Simulation
+    uint64_t seed;                          // Seed every match stream is derived from
+    int streamId;                           // Index of this league within the run
+    MatchEngine matchEngine;                // Engine used for every fixture of the league
+    Scheduler* scheduler;                   // Scheduler a matchday's fixtures are simulated on (NULL => one after another)
 } League;
 
 
@@ -81,6 +157,64 @@ bool addTeamToLeague(League* league, Team* team);
  */
 bool removeTeamFromLeague(League* league, const char* teamName);
 
+/**
+ * Choose the name index the league interns its team names into, so several
+ * leagues (& tournaments) can share one and resolve a name to an id once.
+ * Leagues use getDefaultNameIndex() unless given another one.
+ * 
+ * @param league that we want to set the name index of
+ * @param index to intern team names into (NULL => getDefaultNameIndex())
+ * 
+ * @return boolean indicating success or failure to re-index the league's teams
+ */
+bool setLeagueNameIndex(League* league, NameIndex* index);
+
+/**
+ * Set the seed the league derives its match streams from. Each match draws
+ * from the stream keyed by (seed, streamId, matchday, match index), so a
+ * season replays identically for the same seed and stream id.
+ * 
+ * @param league that we want to seed
+ * @param seed of the simulation run
+ * @param streamId index of the league within the run
+ */
+void setLeagueSeed(League* league, uint64_t seed, int streamId);
+
+/**
+ * Choose the engine used to simulate the league's fixtures
+ * 
+ * @param league that we want to set the engine of
+ * @param engine used for every fixture (MATCH_ENGINE_MINUTE by default)
+ */
+void setLeagueMatchEngine(League* league, MatchEngine engine);
+
+/**
+ * Choose the rules that separate teams level on points, replacing the default
+ * of goal difference then goals scored. Teams still level after every rule keep
+ * their previous order. Rules beyond goal difference & goals scored (i.e. any
+ * head-to-head rule) make each table update re-rank every tied group from the
+ * head-to-head matrices, in O(k^2) per group of k tied teams.
+ * 
+ * @param league that we want to set the tiebreak rules of
+ * @param rules to apply, in order
+ * @param numRules in rules (0 - MAX_TIEBREAK_RULES)
+ * 
+ * @return boolean indicating success or failure to set the rules
+ */
+bool setLeagueTiebreakRules(League* league, const TiebreakRule* rules, int numRules);
+
+/**
+ * Choose a scheduler to simulate each matchday's fixtures on. The fixtures of
+ * a matchday involve disjoint teams and each draws from its own stream, so the
+ * results are the same as simulating them one after another. The season may
+ * itself be a task of the same scheduler.
+ * 
+ * @param league that we want to set the scheduler of
+ * @param scheduler to run the fixtures on (NULL => simulate them one after another), 
+ *        not owned by the league
+ */
+void setLeagueScheduler(League* league, Scheduler* scheduler);
+
 /**
  * Generate a schedule for the league (each team plays each other twice)
  * 
@@ -90,6 +224,28 @@ bool removeTeamFromLeague(League* league, const char* teamName);
  */
 bool generateSchedule(League* league);
 
+/**
+ * Get the fixtures of a matchday, which are stored next to each other
+ * 
+ * @param league that we are looking at
+ * @param matchday that we want the fixtures of (0-based)
+ * @param numMatches -> Pointer to where we store the number of fixtures (may be NULL)
+ * 
+ * @return pointer to the first fixture of the matchday, NULL if there is none
+ */
+Match* getMatchdayFixtures(const League* league, int matchday, int* numMatches);
+
+/**
+ * Get a single fixture of the league
+ * 
+ * @param league that we are looking at
+ * @param matchday of the fixture (0-based)
+ * @param matchIndex of the fixture within the matchday (0-based)
+ * 
+ * @return pointer to the fixture, NULL if there is none
+ */
+Match* getLeagueMatch(const League* league, int matchday, int matchIndex);
+
 /**
  * Simulate the next matchday in the league
  * 
@@ -107,14 +263,54 @@ bool simulateMatchday(League* league);
 void simulateSeason(League* league);
 
 /**
- * Update the league table based on team records
+ * Simulate the entire season without printing anything, so seasons of
+ * different leagues can be simulated on different threads at the same time
+ * 
+ * @param league that we want to simulate the season of
+ * 
+ * @return boolean indicating success or failure of simulation
+ */
+bool playSeason(League* league);
+
+/**
+ * Update the league table based on the standings. Only the teams whose
+ * standings changed since the last update get repositioned (teams that are
+ * level on points & every tiebreak rule keep their previous order), tied
+ * groups are then resolved again if head-to-head rules are in use
  * 
  * @param league that we want to update the table of
  */
 void updateLeagueTable(League* league);
 
 /**
- * Get a team from the league by name
+ * Get the key a team would be ranked by with the given standings: points, then
+ * goal difference & goals scored as far as the league's tiebreak rules start
+ * with them, then the team's current position (rules the key can't hold, i.e.
+ * head-to-head, are left out)
+ * 
+ * @param league whose tiebreak rules & table we rank by
+ * @param slot of the team (its index in league -> teams)
+ * @param points of the team
+ * @param goalDifference of the team
+ * @param goalsScored by the team
+ * 
+ * @return packed ranking key (see packStandingsKey()), higher ranks first
+ */
+uint64_t getRankingKey(const League* league, int slot, int points, int goalDifference, int goalsScored);
+
+/**
+ * Count how many of the league's leading tiebreak rules the ranking keys hold
+ * (goal difference, then goals scored). Any rules past those (i.e. head-to-head)
+ * are only applied by updateLeagueTable() resolving tied groups.
+ * 
+ * @param league whose tiebreak rules we are checking
+ * 
+ * @return number of tiebreak rules held by the ranking keys (0 - 2)
+ */
+int getPackedTiebreakRules(const League* league);
+
+/**
+ * Get a team from the league by name, in O(1) through the league's name index
  * 
  * @param league that we are searching in for a team
  * @param name that we are searching a team for 
@@ -124,7 +320,17 @@ void updateLeagueTable(League* league);
 Team* getTeamByName(const League* league, const char* name);
 
 /**
- * Get a team's position in the league table
+ * Get a team from the league by the id of its name in the league's name index
+ * 
+ * @param league that we want to get the team from
+ * @param nameId of the team (see internName() / findNameId())
+ * 
+ * @return pointer to the team, NULL if no team of the league has that name
+ */
+Team* getTeamByNameId(const League* league, int nameId);
+
+/**
+ * Get a team's position in the league table (O(1) through the table's inverse index)
  * 
  * @param league owning the table we are searching in
  * @param team that we are looking for the position of
@@ -133,6 +339,16 @@ Team* getTeamByName(const League* league, const char* name);
  */
 int getTeamPosition(const League* league, const Team* team);
 
+/**
+ * Get the team at a position in the league table
+ * 
+ * @param league owning the table we are looking at
+ * @param position in the table (1-based)
+ * 
+ * @return pointer to the team in that position, NULL if there is none
+ */
+Team* getTeamAtPosition(const League* league, int position);
+
 /**
  * Print the league table (standings)
  * 
@@ -15,10 +15,23 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <time.h>
 
 #define NUM_LEAGUES 5
 #define TEAMS_PER_LEAGUE 20
 #define NUM_TOURNAMENT_TEAMS 32
+#define QUALIFIERS_PER_LEAGUE 3
+
+
+
+/* STRUCTS */
+
+// One league's season, run as a scheduler task the tournament builder joins on
+typedef struct {
+    League* league;
+    Team* qualifiers[QUALIFIERS_PER_LEAGUE];    // Top teams once the season is over (NULL if it failed)
+    TaskGroup finished;                         // Group of the season's task
+} LeagueSeason;
 
 
 
@@ -65,24 +78,39 @@ Team* createRandomTeam(const char* name, const char* city)
     return team;
 }
 
-// Function to simulate a league season
-void simulateLeagueSeason(League* league)
+// Function to simulate a league season (prints nothing, safe to run next to other leagues)
+bool simulateLeagueSeason(League* league)
 {
     // Validate input
     if (league == NULL)
     {
         fprintf(stderr, "Error: Tried simulating season of a NULL league.\n");
-        return;
+        return false;
     }
 
-    // Generate a schedule for the league
-    if (generateSchedule(league))
+    // Generate a schedule for the league & simulate the season
+    return generateSchedule(league) && playSeason(league);
+}
+
+// Function run as each league's season task: simulate the season, then hand over the qualifiers
+void runLeagueSeason(void* context, int index)
+{
+    LeagueSeason* season = &((LeagueSeason*)context)[index];
+    bool simulated = simulateLeagueSeason(season -> league);
+
+    for (int position = 0; position < QUALIFIERS_PER_LEAGUE; position++)
     {
-        // Simulate season
-        simulateSeason(league);
-        fprintf(stdout, "\n");
+        season -> qualifiers[position] = simulated ? getTeamAtPosition(season -> league, position + 1) : NULL;
     }
-    
+}
+
+// Function to print the final standings of a simulated league season
+void printLeagueSeason(League* league)
+{
+    fprintf(stdout, "Simulating entire season for %s...\n", league -> name);
+    fprintf(stdout, "\n%s Season complete! Final standings:\n", league -> name);
+    printLeagueTable(league);
+    fprintf(stdout, "\n");
 }
 
 // Function to simulate a tournament
@@ -95,7 +123,7 @@ void simulateTournament(Tournament* tournament)
     }
 
     // Make drawings for the tournament
-    if (drawTournament(tournament))
+    if (drawTournament(tournament, getDefaultRandomState()))
     {
         // Simulate tournament
         simulateEntireTournament(tournament);
@@ -113,18 +141,27 @@ void simulateTournament(Tournament* tournament)
 
 /* MAIN FUNCTION */
 
-int main() {
-    // Create and simulate leagues
+int main(int argc, char* argv[]) {
+    // Seed the run (pass a seed as the first argument to reproduce a previous run)
+    uint64_t seed = (argc > 1) ? strtoull(argv[1], NULL, 10) : (uint64_t)time(NULL);
+    seedRandom(seed);
+    fprintf(stdout, "Simulation seed: %llu\n", (unsigned long long)seed);
+
+    // Seasons, matchdays & rounds are simulated on every core (results don't depend on the number of threads)
+    Scheduler* scheduler = createScheduler(0);
+
+    // Create leagues (serially, team ratings come from the seeded global generator)
     League* leagues[NUM_LEAGUES];
     const char* leagueNames[] = {   "La Liga",  "Premier League",   "Bundesliga",   "Serie A",  "Ligue 1"};
     const char* leagueRegions[] = { "Spain",    "England",          "Germany",      "Italy",    "France"};
 
-    // Create and simulate leagues
     fprintf(stdout, "Creating Leagues + Simulating their seasons...\n");
     for (int leagueIndex = 0; leagueIndex < NUM_LEAGUES; leagueIndex++)
     {
         // Create league
         leagues[leagueIndex] = createLeague(leagueNames[leagueIndex], leagueRegions[leagueIndex], TEAMS_PER_LEAGUE);
+        setLeagueSeed(leagues[leagueIndex], seed, leagueIndex);
+        setLeagueScheduler(leagues[leagueIndex], scheduler);
 
         // Add teams to league
         for (int teamIndex = 0; teamIndex < TEAMS_PER_LEAGUE; teamIndex++)
@@ -137,29 +174,47 @@ int main() {
             // Create and add a new team to this league
             addTeamToLeague(leagues[leagueIndex], createRandomTeam(teamName, cityName));
         }
-        simulateLeagueSeason(leagues[leagueIndex]);
     }
-    
-    // Create and fill UCL
-    fprintf(stdout, "\nCreating UCL tournament...\n");
+
+    // Create the UCL up front, so it can be filled while the leagues are still playing
     Tournament* champions = createTournament("Champions League");
+    setTournamentSeed(champions, seed, NUM_LEAGUES);
+    setTournamentScheduler(champions, scheduler);
 
-    // Take top teams from each league ~ 3 * 5 = 15
+    // Fork every league's season (each one forks its matchdays' fixtures in turn)
+    LeagueSeason seasons[NUM_LEAGUES];
     for (int leagueIndex = 0; leagueIndex < NUM_LEAGUES; leagueIndex++)
     {
-        fprintf(stdout, "\nSelcecting teams from %s\n", leagues[leagueIndex]->name);
+        seasons[leagueIndex].league = leagues[leagueIndex];
+        initTaskGroup(&seasons[leagueIndex].finished);
+        spawnTask(scheduler, &seasons[leagueIndex].finished, runLeagueSeason, seasons, leagueIndex);
+    }
 
-        // Selecting top teams from each league
-        for (int teamIndex = 0; teamIndex < 3; teamIndex++)
+    // Take top teams from each league ~ 3 * 5 = 15 as each season is joined, in
+    // league order whichever league finishes first (so a seed always draws the
+    // same bracket)
+    for (int leagueIndex = 0; leagueIndex < NUM_LEAGUES; leagueIndex++)
+    {
+        waitTaskGroup(scheduler, &seasons[leagueIndex].finished);
+
+        printLeagueSeason(leagues[leagueIndex]);
+        for (int teamIndex = 0; teamIndex < QUALIFIERS_PER_LEAGUE; teamIndex++)
+        {
+            addTeamToTournament(champions, seasons[leagueIndex].qualifiers[teamIndex]);
+        }
+    }
+
+    // Print qualifiers
+    fprintf(stdout, "\nCreating UCL tournament...\n");
+    for (int leagueIndex = 0; leagueIndex < NUM_LEAGUES; leagueIndex++)
+    {
+        fprintf(stdout, "\nSelcecting teams from %s\n", leagues[leagueIndex]->name);
+        for (int teamIndex = 0; teamIndex < QUALIFIERS_PER_LEAGUE; teamIndex++)
         {
-            // Get teak ranking from 1st - 3rd
-            int teamRank = leagues[leagueIndex]->leagueTable[teamIndex][0];
-            // Get actual team with that ranking from the league table
-            Team* qualifiedTeam = leagues[leagueIndex]->teams[teamRank];
-
-            // Print qualifiers
-            fprintf(stdout, "\n%s qualified\n", qualifiedTeam->name);
-            addTeamToTournament(champions, qualifiedTeam);
+            if (seasons[leagueIndex].qualifiers[teamIndex] != NULL)
+            {
+                fprintf(stdout, "\n%s qualified\n", seasons[leagueIndex].qualifiers[teamIndex]->name);
+            }
         }
     }
 
@@ -187,6 +242,7 @@ int main() {
     {
         destroyLeague(leagues[leagueIndex]);
     }
+    destroyScheduler(scheduler);
     
     fprintf(stdout, "\nsimulation completed successfully\n");
     return 0;
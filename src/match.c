@@ -9,6 +9,7 @@
 
 // Include
 #include "match.h"
+#include <pthread.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -16,8 +17,15 @@
 
 
 
+// Arenas aren't thread safe, and matches of the same arena can be simulated on
+// different threads, so spilling goals into an arena is serialized (it is rare)
+static pthread_mutex_t arenaSpillLock = PTHREAD_MUTEX_INITIALIZER;
+
+
+
 /* HELPER FUNCTION PROTOYPE(s) */
 void printScoreBoard(Match* match);
+static bool initMatch(Match* match, Team* homeTeam, Team* awayTeam, const char* date, Arena* arena);
 
 
 
@@ -36,65 +44,98 @@ Match* createMatch(Team* homeTeam, Team* awayTeam, const char* date)
         return NULL;
     }
 
-    // Null check home & away teams
-    if (homeTeam == NULL)
+    // Initialize the match (free it again if the input was invalid)
+    if (initMatch(match, homeTeam, awayTeam, date, NULL) == false)
     {
-        fprintf(stderr, "Error: Passed in a home team that doesn't exist.\n");
-        return NULL;
-    } else if (awayTeam == NULL) {
-        fprintf(stderr, "Error: Passed in an away team that doesn't exist.\n");
+        free(match);
         return NULL;
     }
 
-    // Null check date
-    if (date == NULL)
+    return match;
+}
+
+// Constructor for the Match class that allocates the match from an arena
+Match* createMatchInArena(Arena* arena, Team* homeTeam, Team* awayTeam, const char* date)
+{
+    // Null check arena
+    if (arena == NULL)
     {
-        fprintf(stderr, "Error: Passed in a date that doesn't exist.\n");
+        fprintf(stderr, "Error: Tried to create a match in an arena that doesn't exist.\n");
         return NULL;
-    }    
+    }
 
-    // Set home & away teams
-    match -> homeTeam = homeTeam;
-    match -> awayTeam = awayTeam;
+    // Allocate memory for match from the arena
+    Match* match = (Match*)arenaAlloc(arena, sizeof(Match));
+    if (match == NULL)
+    {
+        fprintf(stderr, "Error: failed to allocate memory for a match.\n");
+        return NULL;
+    }
 
-    // Score
-    match -> homeScore = 0;
-    match -> awayScore = 0;
-    match -> numScorers = 0;
-    match -> scorers = NULL;
-    match -> scorerTeamIndices = NULL;
-    match -> scoringMinutes = NULL;
+    // Initialize the match (the memory stays with the arena either way)
+    if (initMatch(match, homeTeam, awayTeam, date, arena) == false)
+    {
+        return NULL;
+    }
 
-    // Set match date
-    strncpy(match -> date, date, sizeof(match -> date) - 1);
-    match -> date[sizeof(match -> date) - 1] = '\0';
+    return match;
+}
 
-    // Match status
-    match -> isCompleted = false;
+// Initialize a match in place, with spilled goals coming from an arena
+bool initMatchInArena(Match* match, Arena* arena, Team* homeTeam, Team* awayTeam, const char* date)
+{
+    // Null check match & arena
+    if (match == NULL)
+    {
+        fprintf(stderr, "Error: Tried to initialize a match that doesn't exist.\n");
+        return false;
+    } else if (arena == NULL) {
+        fprintf(stderr, "Error: Tried to initialize a match in an arena that doesn't exist.\n");
+        return false;
+    }
 
-    return match;
+    return initMatch(match, homeTeam, awayTeam, date, arena);
 }
 
 // Destructor for the Match class
 void destroyMatch(Match* match)
 {
-    // Null check match
-    if (match != NULL)
+    // Null check match, a match from an arena is released with its arena
+    if (match != NULL && match -> arena == NULL)
     {
-        // Free scorers list if it exists
-        if (match -> scorers != NULL) { free(match -> scorers); }
-
-        // Free scorerTeamIndices if it exists
-        if (match -> scorerTeamIndices != NULL) { free(match -> scorerTeamIndices); }
-        
-        // Free scoringMinutes if it exists
-        if (match -> scoringMinutes != NULL) { free(match -> scoringMinutes); }
+        // Free the spilled goals if a blowout needed them
+        if (match -> spillGoals != NULL) { free(match -> spillGoals); }
         
         // Free the team
         free(match);
     }
 }
 
+// Reset a match so that it can be played again
+void resetMatch(Match* match)
+{
+    // Null check match
+    if (match == NULL)
+    {
+        fprintf(stderr, "Error: Tried to reset a match that doesn't exist.\n");
+        return;
+    }
+
+    match -> homeScore = 0;
+    match -> awayScore = 0;
+    match -> numScorers = 0;
+    match -> isCompleted = false;
+}
+
+// Get the goals recorded in a match
+const GoalEvent* getMatchGoals(const Match* match)
+{
+    if (match == NULL) { return NULL; }
+
+    // Once spilled, every goal lives in the spill buffer
+    return (match -> spillGoals != NULL) ? match -> spillGoals : match -> inlineGoals;
+}
+
 // Record a goal scored in the match (0 => home; 1 => away)
 void recordGoal(Match* match, Player* scorer, int teamIndex, int minute)
 {
@@ -122,21 +163,48 @@ void recordGoal(Match* match, Player* scorer, int teamIndex, int minute)
         return;
     }
     
-    // Number of scorers
-    match -> numScorers++;
+    // Spill to the heap (doubling) only once the current storage is full
+    int capacity = (match -> spillGoals != NULL) ? match -> spillCapacity : MATCH_INLINE_GOALS;
+    if (match -> numScorers >= capacity)
+    {
+        int newCapacity = capacity * 2;
+        GoalEvent* spillGoals = NULL;
+
+        if (match -> arena != NULL) {
+            // Arena matches take a fresh, bigger buffer from the arena & copy over
+            pthread_mutex_lock(&arenaSpillLock);
+            spillGoals = (GoalEvent*)arenaAlloc(match -> arena, newCapacity * sizeof(GoalEvent));
+            pthread_mutex_unlock(&arenaSpillLock);
+            if (spillGoals != NULL)
+            {
+                memcpy(spillGoals, getMatchGoals(match), match -> numScorers * sizeof(GoalEvent));
+            }
+        } else {
+            spillGoals = (GoalEvent*)realloc(match -> spillGoals, newCapacity * sizeof(GoalEvent));
+
+            // First spill, move the inline goals over
+            if (spillGoals != NULL && match -> spillGoals == NULL)
+            {
+                memcpy(spillGoals, match -> inlineGoals, match -> numScorers * sizeof(GoalEvent));
+            }
+        }
 
-    // Resizing the arrays of scorers, team indices and minutes that we created
-    match -> scorers = (Player**)realloc(match -> scorers, 
-                                        match -> numScorers * sizeof(Player*));
-    match -> scorerTeamIndices = (int*)realloc(match -> scorerTeamIndices, 
-                                                match -> numScorers * sizeof(int));
-    match -> scoringMinutes = (int*)realloc(match -> scoringMinutes, 
-                                            match -> numScorers * sizeof(int));
+        if (spillGoals == NULL)
+        {
+            fprintf(stderr, "Error: Failed allocating memory for %d goals.\n", newCapacity);
+            return;
+        }
 
-    // Update scorers, team indices, and minutes with most goal details
-    match -> scorers[match -> numScorers - 1] = scorer;
-    match -> scorerTeamIndices[match -> numScorers - 1] = teamIndex;
-    match -> scoringMinutes[match -> numScorers - 1] = minute;
+        match -> spillGoals = spillGoals;
+        match -> spillCapacity = newCapacity;
+    }
+
+    // Store the goal details
+    GoalEvent* goal = (GoalEvent*)getMatchGoals(match) + match -> numScorers;
+    goal -> scorer = scorer;
+    goal -> teamIndex = teamIndex;
+    goal -> minute = minute;
+    match -> numScorers++;
 
     // Home team scored
     if (teamIndex == 0) { match -> homeScore++; }
@@ -208,13 +276,14 @@ void printMatchReport(Match* match)
             fprintf(stdout, "\nGoal Scorers:\n");
 
             // Print each goal's information
+            const GoalEvent* goals = getMatchGoals(match);
             for (int i = 0; i < match -> numScorers; i++) {
                 fprintf(stdout, 
                         "%d' - %s (%s)\n", 
-                        match -> scoringMinutes[i],
-                        match -> scorers[i] -> name,
+                        goals[i].minute,
+                        goals[i].scorer -> name,
                         // If scoring team was home then => print home team name : else print away team name
-                        match -> scorerTeamIndices[i] == 0 ? match -> homeTeam -> name : match -> awayTeam -> name);
+                        goals[i].teamIndex == 0 ? match -> homeTeam -> name : match -> awayTeam -> name);
             }
         }
 
@@ -289,6 +358,53 @@ int getMatchWinner(Match* match)
 
 /* HELPER FUNCTION(S) */
 
+// Helper function to initialize a match in place
+static bool initMatch(Match* match, Team* homeTeam, Team* awayTeam, const char* date, Arena* arena)
+{
+    // Null check home & away teams
+    if (homeTeam == NULL)
+    {
+        fprintf(stderr, "Error: Passed in a home team that doesn't exist.\n");
+        return false;
+    } else if (awayTeam == NULL) {
+        fprintf(stderr, "Error: Passed in an away team that doesn't exist.\n");
+        return false;
+    }
+
+    // Null check date
+    if (date == NULL)
+    {
+        fprintf(stderr, "Error: Passed in a date that doesn't exist.\n");
+        return false;
+    }    
+
+    // Set home & away teams
+    match -> homeTeam = homeTeam;
+    match -> awayTeam = awayTeam;
+    match -> homeSlot = -1;
+    match -> awaySlot = -1;
+
+    // Score
+    match -> homeScore = 0;
+    match -> awayScore = 0;
+    match -> numScorers = 0;
+    match -> spillGoals = NULL;
+    match -> spillCapacity = 0;
+    match -> arena = arena;
+
+    // Set match date
+    strncpy(match -> date, date, sizeof(match -> date) - 1);
+    match -> date[sizeof(match -> date) - 1] = '\0';
+
+    // Match status
+    match -> isCompleted = false;
+
+    // Simulation
+    match -> engine = MATCH_ENGINE_MINUTE;
+
+    return true;
+}
+
 // Pretty print out the scoreboard
 void printScoreBoard(Match* match)
 {
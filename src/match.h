@@ -12,6 +12,7 @@
 
 #include "player.h"
 #include "team.h"
+#include "arena.h"
 #include <stdbool.h>
 
 // Macros (0 => home, 1 => away, -1 => draw)
@@ -19,10 +20,30 @@
 #define AWAY_TEAM 1
 #define DRAW -1
 
+#define MATCH_INLINE_GOALS 8    // Goals stored inside the Match itself before spilling to the heap
+
 
 
 /* FUNCTION PROTOTYPES */
 
+/**
+ * MatchEngine @enum selecting how a match's goals are simulated
+ */
+typedef enum {
+    MATCH_ENGINE_MINUTE,        // A scoring trial for each team every minute
+    MATCH_ENGINE_BINOMIAL,      // Goals per half sampled directly, then placed on minutes
+    MATCH_ENGINE_EVENT          // Jumps straight from one goal/injury event to the next
+} MatchEngine;
+
+/**
+ * GoalEvent @struct representing a single goal scored in a match
+ */
+typedef struct {
+    Player* scorer;             // Player who scored the goal
+    int teamIndex;              // Team the goal was for (0 => home, 1 => away)
+    int minute;                 // Minute the goal was scored in
+} GoalEvent;
+
 /**
  * Match @struct representing a game between two football teams
  */
@@ -30,20 +51,26 @@ typedef struct {
     // Teams
     Team* homeTeam;             // (0 => home)
     Team* awayTeam;             // (1 => away)
+    int homeSlot;               // Index of the home team in its competition (-1 => not set)
+    int awaySlot;               // Index of the away team in its competition (-1 => not set)
 
     // Score
     int homeScore;
     int awayScore;
-    int numScorers;
-    Player** scorers;           // Array of pointers to players who have scored
-    int* scorerTeamIndices;     // Array of indices representing for what team the ith goal was for (0 => home, 1 => away)
-    int* scoringMinutes;
+    int numScorers;             // Number of goals recorded (see getMatchGoals())
+    GoalEvent inlineGoals[MATCH_INLINE_GOALS];  // Goals of a typical scoreline, no allocation needed
+    GoalEvent* spillGoals;      // Heap buffer holding every goal once a blowout outgrows inlineGoals (else NULL)
+    int spillCapacity;          // Number of goals spillGoals has room for
+    Arena* arena;               // Arena the match & its spilled goals live in (NULL => heap, see createMatchInArena())
 
     // Game status
     char date[20];
 
     // Match status
     bool isCompleted;
+
+    // Simulation
+    MatchEngine engine;         // How the match gets simulated (MATCH_ENGINE_MINUTE by default)
 } Match;
 
 /**
@@ -56,12 +83,58 @@ typedef struct {
 Match* createMatch(Team* homeTeam, Team* awayTeam, const char* date);
 
 /**
- * Destructor for the Match class
+ * Constructor for the Match class that allocates the match from an arena
+ * instead of the heap. Goals that spill out of the match's inline storage come
+ * from the same arena, so the match never has to be destroyed: it is released
+ * along with everything else when the arena is reset or freed.
+ * 
+ * @param arena that the match is allocated from
+ * @param homeTeam
+ * @param awayTeam
+ * @param date that the match is/was played on
+ */
+Match* createMatchInArena(Arena* arena, Team* homeTeam, Team* awayTeam, const char* date);
+
+/**
+ * Initialize a match in place (i.e. inside a contiguous array of matches that
+ * was allocated from an arena). Like createMatchInArena(), goals that spill out
+ * of the match's inline storage come from the arena & the match is released
+ * with the arena.
+ * 
+ * @param match that we are initializing
+ * @param arena that spilled goals are allocated from
+ * @param homeTeam
+ * @param awayTeam
+ * @param date that the match is/was played on
+ * 
+ * @return bool (true => initialized, false if the input was invalid)
+ */
+bool initMatchInArena(Match* match, Arena* arena, Team* homeTeam, Team* awayTeam, const char* date);
+
+/**
+ * Destructor for the Match class (does nothing for a match from an arena)
  * 
  * @param match that we want to free the memory of
  */
 void destroyMatch(Match* match);
 
+/**
+ * Reset a match so that it can be played again, keeping any spill buffer it
+ * grew for reuse
+ * 
+ * @param match that we want to reset
+ */
+void resetMatch(Match* match);
+
+/**
+ * Get the goals recorded in a match, in the order they were recorded
+ * 
+ * @param match that we are interested in
+ * 
+ * @return array of match -> numScorers goal events (NULL for a NULL match)
+ */
+const GoalEvent* getMatchGoals(const Match* match);
+
 /**
  * Record a goal scored in the match
  * 
@@ -16,23 +16,125 @@
 #include "random_utils.h"
 #include <stdbool.h>
 #include <stdlib.h>
-#include <time.h>
 #include <stdio.h>
 #include <string.h>
+#include <math.h>
+
+#define MINUTE_DRAW_CHUNK 64    // Minutes of random draws generated per bulk call
+
+#define INJURY_PROBABILITY 0.025    // Chance of a player getting injured in a match
+#define NO_ASSIST_PROBABILITY 0.3   // Chance of a goal being unassisted
+
+// Integer thresholds for the fixed probabilities above
+#define INJURY_THRESHOLD RANDOM_THRESHOLD(INJURY_PROBABILITY)
+#define NO_ASSIST_THRESHOLD RANDOM_THRESHOLD(NO_ASSIST_PROBABILITY)
+
+#define MAX_PERIOD_GOALS 64     // Most goals one team can be given in a single sampled period
+#define EXPECTED_PLAYED_MINUTES 102 // Average minutes simulated per match (both halves plus stoppage time)
+
+// Scoring & assisting weight multipliers, indexed by Position
+static const double SCORING_POSITION_WEIGHT[NUM_POSITIONS] = {
+    [POSITION_GKP] = 0.01, [POSITION_DEF] = 0.75, [POSITION_MID] = 1.25, [POSITION_FWD] = 2.0
+};
+static const double ASSIST_POSITION_WEIGHT[NUM_POSITIONS] = {
+    [POSITION_GKP] = 0.01, [POSITION_DEF] = 0.75, [POSITION_MID] = 2.0, [POSITION_FWD] = 1.25
+};
+
+
+
+/* HELPER FUNCTION PROTOTYPE(s) */
+static bool scoreMatchGoal(MatchContext* context, int teamIndex, int minute);
+static int sampleGoalMinutes(RandomState* rng, int startMinute, int numMinutes, int numGoals, int* minutes);
+static void simulatePeriod(MatchContext* context, int startMinute, int endMinute);
+static int countHealthyPlayers(const Team* team);
+static double scoringWeight(const RosterEntry* entry);
+static double assistWeight(const RosterEntry* entry);
+static void refreshTeamSamplers(Team* team);
+static void injureRandomPlayer(MatchContext* context, int teamIndex);
+static int sampleGoals(RandomState* rng, int numMinutes, double probability, double zeroProbability);
 
 
 
 /* FUNCTIONS */
 
+// Build the context for a match that is about to be played
+bool initMatchContext(MatchContext* context, Match* match, RandomState* rng)
+{
+    // Validate input
+    if (context == NULL)
+    {
+        fprintf(stderr, "Error: Tried to build a NULL match context.\n");
+        return false;
+    }
+    else if (match == NULL || match -> homeTeam == NULL || match -> awayTeam == NULL)
+    {
+        fprintf(stderr, "Error: Tried to build a match context for a match or team that doesn't exist.\n");
+        return false;
+    }
+
+    context -> match = match;
+    context -> rng = rng;
+    context -> lanesSeeded = false;
+    refreshMatchContext(context);
+
+    return true;
+}
+
+// Recompute the scoring rates of a match context from the current teams
+void refreshMatchContext(MatchContext* context)
+{
+    // NULL check context
+    if (context == NULL || context -> match == NULL)
+    {
+        fprintf(stderr, "Error: Tried to refresh a match context that doesn't exist.\n");
+        return;
+    }
+
+    Team* homeTeam = context -> match -> homeTeam;
+    Team* awayTeam = context -> match -> awayTeam;
+
+    // Scoring rates for both sides
+    context -> scoringProbability[HOME_TEAM] = calculateScoringProbability(homeTeam, awayTeam);
+    context -> scoringProbability[AWAY_TEAM] = calculateScoringProbability(awayTeam, homeTeam);
+    context -> scoringThreshold[HOME_TEAM] = randomThreshold(context -> scoringProbability[HOME_TEAM]);
+    context -> scoringThreshold[AWAY_TEAM] = randomThreshold(context -> scoringProbability[AWAY_TEAM]);
+
+    // Continuous time rates, chosen so that a minute without a goal (or a match
+    // without an injury for a player) is exactly as likely as in the other engines
+    double playerInjuryHazard = -log(1.0 - INJURY_PROBABILITY) / EXPECTED_PLAYED_MINUTES;
+    for (int teamIndex = HOME_TEAM; teamIndex <= AWAY_TEAM; teamIndex++)
+    {
+        Team* team = (teamIndex == HOME_TEAM) ? homeTeam : awayTeam;
+        context -> goalHazard[teamIndex] = -log(1.0 - context -> scoringProbability[teamIndex]);
+        context -> injuryHazard[teamIndex] = playerInjuryHazard * countHealthyPlayers(team);
+    }
+
+    context -> needsRefresh = false;
+}
+
+// Mark a match context as stale after an in-match event changed the teams
+void invalidateMatchContext(MatchContext* context)
+{
+    if (context != NULL)
+    {
+        context -> needsRefresh = true;
+    }
+}
+
 // Simulate a complete match between two teams
-void simulateMatch(Match* match)
+void simulateMatch(Match* match, RandomState* rng)
 {
-    // Null check match 
+    // Null check match & random stream
     if (match == NULL)
     {
         fprintf(stderr, "Error: Tried to simulate a match that doesn't exist.\n");
         return;
     }
+    else if (rng == NULL)
+    {
+        fprintf(stderr, "Error: Tried to simulate a match without a random stream.\n");
+        return;
+    }
     
     // Make sure that the match hasn't been simulated already
     if (match -> isCompleted)
@@ -41,16 +143,26 @@ void simulateMatch(Match* match)
         return;
     }
 
+    // Scoring rates don't change during the match, so compute them once
+    MatchContext context;
+    if (initMatchContext(&context, match, rng) == false)
+    {
+        return;
+    }
+
     // 1st half
-    int stoppageTimeFirstHalf = randomInt(0, 10);
-    simulateMatchMinutes(match, 0, 45 + stoppageTimeFirstHalf);
+    int stoppageTimeFirstHalf = randomStateInt(rng, 0, MAX_STOPPAGE_TIME);
+    simulatePeriod(&context, 0, 45 + stoppageTimeFirstHalf);
 
     // 2nd half
-    int stoppageTimeSecondHalf = randomInt(0, 10);
-    simulateMatchMinutes(match, 45, 90 + stoppageTimeSecondHalf);
+    int stoppageTimeSecondHalf = randomStateInt(rng, 0, MAX_STOPPAGE_TIME);
+    simulatePeriod(&context, 45, 90 + stoppageTimeSecondHalf);
 
-    // Any injuries that may have occurred during the match
-    simulateInjuries(match);
+    // Any injuries that may have occurred during the match (the event engine plays them out live)
+    if (match -> engine != MATCH_ENGINE_EVENT)
+    {
+        simulateInjuries(match, rng);
+    }
 
     // Update game status
     match -> isCompleted = true;
@@ -77,8 +189,8 @@ double calculateScoringProbability(Team* team, Team* opponentTeam)
     double scoringProbability = 0.015;
 
     // Get team ratings
-    double teamRating = calculateTeamRating(team);
-    double opponentTeamRating = calculateTeamRating(opponentTeam);
+    double teamRating = getTeamRating(team);
+    double opponentTeamRating = getTeamRating(opponentTeam);
 
     // Calculate ratio between team ratings
     double teamRatingRatio = teamRating / opponentTeamRating;
@@ -99,100 +211,48 @@ double calculateScoringProbability(Team* team, Team* opponentTeam)
 }
 
 // Determine which player on the team scored the goal
-Player* determineScorer(Team* team)
+Player* determineScorer(Team* team, RandomState* rng)
 {
     // Validate input
     if (team == NULL)
     {
         fprintf(stderr, "Error: Tried finding scorer for a NULL team.\n");
         return NULL;
-    } 
-    else if (team -> numPlayers <= 0)
-    {
-        fprintf(stderr, "Error: Tried finding scorer for a team with %d players.\n", 
-        team -> numPlayers);
-        return NULL;
     }
-
-    // Allocate memory for weights
-    double* weights = (double*)malloc(sizeof(double) * team -> numPlayers);
-    double totalWeight = 0.0;
-
-    // Null check weights
-    if (weights == NULL)
+    else if (rng == NULL)
     {
-        fprintf(stderr, "Error: Failed allocating memory for weights array.\n");
+        fprintf(stderr, "Error: Tried finding scorer without a random stream.\n");
         return NULL;
     }
-
-    // Assign weights based on player attributes
-    for (int i = 0; i < team -> numPlayers; i++)
-    {
-        // Pick a player off of the roster and assign their initial weight
-        Player* player = team -> players[i];
-        double weight = player -> rating;
-
-        // Adjust weights based on their positions
-        if (strcmp(player -> position, "fwd") == 0) { weight *= 2.0; }          // Forwards
-        else if (strcmp(player -> position, "mid") == 0) { weight *= 1.25; }    // Midfielders
-        else if (strcmp(player -> position, "def") == 0) { weight *= 0.75; }    // Defenders
-        else if (strcmp(player -> position, "gkp") == 0) { weight *= 0.01; }    // Goal Keepers
-
-        // Exclude injured players
-        if (player -> injuryStatus == true) { weight = 0.0; }
-
-        // Store weights and compute total
-        weights[i] = weight;
-        totalWeight += weight;
-    }
-
-    // If no eligible scorers (all injured)
-    if (totalWeight <= 0.0)
+    else if (team -> numPlayers <= 0)
     {
-        free(weights);
+        fprintf(stderr, "Error: Tried finding scorer for a team with %d players.\n", 
+        team -> numPlayers);
         return NULL;
     }
 
-    // Select player based on weighted probability
-    double randomValue = randomProbability() * totalWeight;
-    double cumulativeWeight = 0.0;
-
-    for (int i = 0; i < team -> numPlayers; i++)
-    {
-        cumulativeWeight += weights[i];
-        if (randomValue <= cumulativeWeight)
-        {
-            Player* scorer = team -> players[i];
-            free(weights);
-            return scorer;
-        }   
-    }
-
-    // Fallback, if no player is selected just select whoever is not injured
-    free(weights);
-
-    for (int i = 0; i < team -> numPlayers; i++)
-    {
-        if (team -> players[i] -> injuryStatus == false)
-        {
-            return team -> players[i];
-        }
-    }
+    // Rebuild the samplers if the roster changed since the last goal
+    refreshTeamSamplers(team);
 
-    fprintf(stderr, "Error: Could not find a player on %s who could've scored a goal.\n", 
-            team -> name);
-    return NULL;
+    // Select player based on weighted probability (NULL if every player is injured)
+    int index = sampleAliasTable(&team -> scorerTable, rng);
+    return (index >= 0) ? team -> players[index] : NULL;
 }
 
 // Determine which player assisted the goal (if applicable)
-Player* determineAssist(Team* team, Player* scorer)
+Player* determineAssist(Team* team, Player* scorer, RandomState* rng)
 {
     // Validate input
     if (team == NULL)
     {
         fprintf(stderr, "Error: Tried finding assister for a NULL team.\n");
         return NULL;
-    } 
+    }
+    else if (rng == NULL)
+    {
+        fprintf(stderr, "Error: Tried finding assister without a random stream.\n");
+        return NULL;
+    }
     else if (team -> numPlayers <= 0)
     {
         fprintf(stderr, "Error: Tried finding assister for a team with %d players.\n", 
@@ -201,87 +261,36 @@ Player* determineAssist(Team* team, Player* scorer)
     }
 
     // 30% chance of no assist
-    if (randomProbability() < 0.3)
+    if (randomBernoulli(rng, NO_ASSIST_THRESHOLD))
     {
         return NULL;
     }
 
-    // Allocate memory for weighted probabilities
-    double* weights = (double*)malloc(sizeof(double) * team -> numPlayers);
-    double totalWeight = 0.0;
+    // Rebuild the samplers if the roster changed since the last goal
+    refreshTeamSamplers(team);
 
-    // Null check weights
-    if (weights == NULL)
+    // Nobody else left who could have assisted
+    int scorerIndex = (scorer != NULL && scorer -> number >= 0 && scorer -> number <= MAX_JERSEY_NUMBER) 
+                        ? team -> jerseySlots[scorer -> number] : -1;
+    const RosterEntry* scorerEntry = (scorerIndex >= 0) ? &team -> roster[scorerIndex] : NULL;
+    double scorerWeight = (scorerEntry != NULL && scorerEntry -> injured == false) ? assistWeight(scorerEntry) : 0.0;
+    if (team -> assistTable.totalWeight - scorerWeight <= team -> assistTable.totalWeight * 1e-12)
     {
-        fprintf(stderr, "Error: Failed allocating memory for weights array.\n");
         return NULL;
     }
 
-    // Assign assist weights
-    for (int i = 0; i < team -> numPlayers; i++)
+    // Select player based on weighted probability, drawing again if we land on
+    // the scorer (same as leaving them out of the table)
+    while (true)
     {
-        Player* player = team -> players[i];
-
-        // Don't include the scorer of the goal
-        if (player == scorer)
-        {
-            weights[i] = 0.0;
-            continue;
-        }
-        
-        double weight = player -> rating;
-
-        // Adjust weights based on their positions
-        if (strcmp(player -> position, "fwd") == 0) { weight *= 1.25; }          // Forwards
-        else if (strcmp(player -> position, "mid") == 0) { weight *= 2.0; }    // Midfielders
-        else if (strcmp(player -> position, "def") == 0) { weight *= 0.75; }    // Defenders
-        else if (strcmp(player -> position, "gkp") == 0) { weight *= 0.01; }    // Goal Keepers
-
-        // Exclude injured players
-        if (player -> injuryStatus == true) { weight = 0.0; }
-
-        // Store weights and compute total
-        weights[i] = weight;
-        totalWeight += weight;        
+        int index = sampleAliasTable(&team -> assistTable, rng);
+        if (index < 0) { return NULL; }
+        if (index != scorerIndex) { return team -> players[index]; }
     }
-
-    // Select player based on weighted probability
-    if (totalWeight <= 0.0)
-    {
-        free(weights);
-        return NULL;
-    }
-    
-    double randomValue = randomProbability() * totalWeight;
-    double cumulativeWeight = 0.0;
-    for (int i = 0; i < team -> numPlayers; i++)
-    {
-        cumulativeWeight += weights[i];
-        if (randomValue <= cumulativeWeight)
-        {
-            free(weights);
-            return team -> players[i];
-        }
-    }
-    
-    // Fallback, if no player is selected just select whoever is not injured
-    free(weights);
-
-    for (int i = 0; i < team -> numPlayers; i++)
-    {
-        if (team -> players[i] -> injuryStatus == false)
-        {
-            return team -> players[i];
-        }
-    }
-
-    fprintf(stderr, "Error: Could not find a player on %s who could've assisted a goal.\n", 
-            team -> name);
-    return NULL;
 }
 
 // Simulate any potential injuries that would occur during a match
-void simulateInjuries(Match* match)
+void simulateInjuries(Match* match, RandomState* rng)
 {
     // Verify input
     if (match == NULL || match -> homeTeam == NULL || match -> awayTeam == NULL)
@@ -289,6 +298,11 @@ void simulateInjuries(Match* match)
         fprintf(stderr, "Error: Match or one of it's participating teams were NULL.\n");
         return;
     }
+    else if (rng == NULL)
+    {
+        fprintf(stderr, "Error: Tried simulating injuries without a random stream.\n");
+        return;
+    }
 
     // Get home and away teams
     Team* homeTeam = match -> homeTeam;
@@ -297,13 +311,10 @@ void simulateInjuries(Match* match)
     // Home team injuries
     for (int i = 0; i < homeTeam -> numPlayers; i++)
     {
-        // Get player from the home team
-        Player* player = homeTeam -> players[i];
-
-        // 2.5% chance of injury per match
-        if (randomProbability() < 0.025 && player -> injuryStatus == false)
+        // 2.5% chance of injury per match (the Player is only visited when it happens)
+        if (randomBernoulli(rng, INJURY_THRESHOLD) && homeTeam -> roster[i].injured == false)
         {
-            updateInjuryStatus(player, true);
+            setPlayerInjuryStatus(homeTeam, homeTeam -> players[i] -> number, true);
             
             // // Print injury announcement
             // fprintf(stdout, 
@@ -315,13 +326,10 @@ void simulateInjuries(Match* match)
     // Away team injuries
     for (int i = 0; i < awayTeam -> numPlayers; i++)
     {
-        // Get player from the away team
-        Player* player = awayTeam -> players[i];
-
-        // 2.5% chance of injury per match
-        if (randomProbability() < 0.025 && player -> injuryStatus == false)
+        // 2.5% chance of injury per match (the Player is only visited when it happens)
+        if (randomBernoulli(rng, INJURY_THRESHOLD) && awayTeam -> roster[i].injured == false)
         {
-            updateInjuryStatus(player, true);
+            setPlayerInjuryStatus(awayTeam, awayTeam -> players[i] -> number, true);
 
             // // Print injury announcement
             // fprintf(stdout, 
@@ -332,18 +340,27 @@ void simulateInjuries(Match* match)
 }
 
 // Simulate the minutes of a match, from start -> end
-void simulateMatchMinutes(Match* match, int startMinute, int endMinute)
+void simulateMatchMinutes(MatchContext* context, int startMinute, int endMinute)
 {
     // Validate input
-    if (match == NULL)
+    if (context == NULL || context -> match == NULL)
     {
         fprintf(stderr, "Error: Tried simulating minutes for a NULL match.\n");
         return;
     }
-    else if (match -> homeTeam == NULL || match -> awayTeam == NULL)
+    else if (context -> rng == NULL)
     {
-        fprintf(stderr, "Error: Simulating minutes w/one or more NULL teams - %s or %s.\n", 
-                match -> homeTeam -> name, match -> awayTeam -> name);
+        fprintf(stderr, "Error: Tried simulating minutes without a random stream.\n");
+        return;
+    }
+
+    Match* match = context -> match;
+    RandomState* rng = context -> rng;
+
+    if (match -> homeTeam == NULL || match -> awayTeam == NULL)
+    {
+        fprintf(stderr, "Error: Simulating minutes for %s with one or more NULL teams.\n", 
+                match -> date);
         return;
     }
     else if (startMinute < 0 || endMinute < startMinute)
@@ -352,66 +369,376 @@ void simulateMatchMinutes(Match* match, int startMinute, int endMinute)
                 startMinute, endMinute);
         return;
     }
-    
-    // Get Home and Away teams
-    Team* homeTeam = match -> homeTeam;
-    Team* awayTeam = match -> awayTeam;
 
-    // Simulate each minute
-    for (int minute = startMinute; minute <= endMinute; minute++)
+
+    // Random draws for a chunk of minutes (2 per minute: home then away), from
+    // lanes seeded once per match & kept across both halves
+    uint32_t draws[2 * MINUTE_DRAW_CHUNK];
+    if (context -> lanesSeeded == false)
+    {
+        seedRandomLanes(&context -> lanes, rng);
+        context -> lanesSeeded = true;
+    }
+
+    // Simulate the minutes a chunk at a time (a whole half fits in one chunk)
+    for (int chunkStart = startMinute; chunkStart <= endMinute; chunkStart += MINUTE_DRAW_CHUNK)
     {
-        // Check if home team scores
-        double homeTeamScoreProbability = calculateScoringProbability(homeTeam, awayTeam);
-        if (randomProbability() < homeTeamScoreProbability)
+        int chunkEnd = chunkStart + MINUTE_DRAW_CHUNK - 1;
+        if (chunkEnd > endMinute) { chunkEnd = endMinute; }
+
+        // Draw every random number the chunk needs in one bulk call
+        randomFillUint32(&context -> lanes, draws, 2 * (chunkEnd - chunkStart + 1));
+
+        // Simulate each minute
+        for (int minute = chunkStart; minute <= chunkEnd; minute++)
         {
-            // Get the player who scored the goal
-            Player* scorer = determineScorer(homeTeam);
-            
-            // Null check our scorer
-            if (scorer == NULL)
+            const uint32_t* minuteDraws = &draws[2 * (minute - chunkStart)];
+
+            // Recompute the rates only if something changed the teams mid-match
+            if (context -> needsRefresh) { refreshMatchContext(context); }
+
+            // Check if home team scores (a missing scorer skips the rest of the minute)
+            if (minuteDraws[HOME_TEAM] < context -> scoringThreshold[HOME_TEAM] && 
+                scoreMatchGoal(context, HOME_TEAM, minute) == false)
             {
-                fprintf(stderr, "Error: Couldn't find a scorer for %s at %d'.\n", 
-                        homeTeam -> name, minute);
                 continue;
             }
 
-            // Recording goal for player & home team (0 => home)
-            recordGoal(match, scorer, HOME_TEAM, minute);
-            
-            // Check for assist
-            Player* assister = determineAssist(homeTeam, scorer);
-            if (assister)
+            // Check if away team scores
+            if (minuteDraws[AWAY_TEAM] < context -> scoringThreshold[AWAY_TEAM])
             {
-                // Recording assist for player
-                assist(assister);
+                scoreMatchGoal(context, AWAY_TEAM, minute);
             }
         }
+    }
+}
 
-        // Check if away team scores
-        double awayTeamScoreProbability = calculateScoringProbability(awayTeam, homeTeam);
-        if (randomProbability() < awayTeamScoreProbability)
+// Simulate a period by sampling each team's goal count directly
+void sampleMatchGoals(MatchContext* context, int startMinute, int endMinute)
+{
+    // Validate input
+    if (context == NULL || context -> match == NULL)
+    {
+        fprintf(stderr, "Error: Tried sampling goals for a NULL match.\n");
+        return;
+    }
+    else if (context -> rng == NULL)
+    {
+        fprintf(stderr, "Error: Tried sampling goals without a random stream.\n");
+        return;
+    }
+    else if (startMinute < 0 || endMinute < startMinute)
+    {
+        fprintf(stderr, "Error: Invalid minutes, start: %d end: %d.\n", 
+                startMinute, endMinute);
+        return;
+    }
+
+    if (context -> needsRefresh) { refreshMatchContext(context); }
+
+    // The per minute trials are independent with a constant probability, so
+    // each team's goal count over the period is binomially distributed
+    int numMinutes = endMinute - startMinute + 1;
+    int goalMinutes[2][MAX_PERIOD_GOALS];
+    int numGoals[2];
+
+    for (int teamIndex = HOME_TEAM; teamIndex <= AWAY_TEAM; teamIndex++)
+    {
+        numGoals[teamIndex] = randomBinomial(context -> rng, numMinutes, 
+                                            context -> scoringProbability[teamIndex]);
+
+        // Minutes are only placed when there are goals to place
+        numGoals[teamIndex] = sampleGoalMinutes(context -> rng, startMinute, numMinutes, 
+                                                numGoals[teamIndex], goalMinutes[teamIndex]);
+    }
+
+    // Record goals in minute order (home team first within a minute, like the minute loop)
+    int next[2] = { 0, 0 };
+    while (next[HOME_TEAM] < numGoals[HOME_TEAM] || next[AWAY_TEAM] < numGoals[AWAY_TEAM])
+    {
+        int teamIndex = HOME_TEAM;
+        if (next[HOME_TEAM] >= numGoals[HOME_TEAM] || 
+            (next[AWAY_TEAM] < numGoals[AWAY_TEAM] && 
+             goalMinutes[AWAY_TEAM][next[AWAY_TEAM]] < goalMinutes[HOME_TEAM][next[HOME_TEAM]]))
         {
-            // Get the player who scored the goal
-            Player* scorer = determineScorer(awayTeam);
-            
-            // Null check our scorer
-            if (scorer == NULL)
-            {
-                fprintf(stderr, "Error: Couldn't find a scorer for %s at %d'.\n", 
-                        awayTeam -> name, minute);
-                continue;
-            }
+            teamIndex = AWAY_TEAM;
+        }
 
-            // Recording goal for player & away team (1 => away)
-            recordGoal(match, scorer, AWAY_TEAM, minute);
-            
-            // Check for assist
-            Player* assister = determineAssist(awayTeam, scorer);
-            if (assister)
+        scoreMatchGoal(context, teamIndex, goalMinutes[teamIndex][next[teamIndex]]);
+        next[teamIndex]++;
+    }
+}
+
+
+// Simulate a period of a match as a sequence of discrete events
+void simulateMatchEvents(MatchContext* context, int startMinute, int endMinute)
+{
+    // Validate input
+    if (context == NULL || context -> match == NULL)
+    {
+        fprintf(stderr, "Error: Tried simulating events for a NULL match.\n");
+        return;
+    }
+    else if (context -> rng == NULL)
+    {
+        fprintf(stderr, "Error: Tried simulating events without a random stream.\n");
+        return;
+    }
+    else if (startMinute < 0 || endMinute < startMinute)
+    {
+        fprintf(stderr, "Error: Invalid minutes, start: %d end: %d.\n", 
+                startMinute, endMinute);
+        return;
+    }
+
+    // The period covers minutes startMinute..endMinute, i.e. [startMinute, endMinute + 1)
+    double time = startMinute;
+    double endTime = endMinute + 1;
+
+    while (true)
+    {
+        // Hazards may have changed after the last event
+        if (context -> needsRefresh) { refreshMatchContext(context); }
+
+        double rates[4] = {
+            context -> goalHazard[HOME_TEAM], context -> goalHazard[AWAY_TEAM], 
+            context -> injuryHazard[HOME_TEAM], context -> injuryHazard[AWAY_TEAM]
+        };
+        double totalRate = rates[0] + rates[1] + rates[2] + rates[3];
+        if (totalRate <= 0.0) { break; }
+
+        // Jump to the next event, exponentially distributed inter-arrival time
+        time += -log(1.0 - randomStateProbability(context -> rng)) / totalRate;
+        if (time >= endTime) { break; }
+        int minute = (int)time;
+
+        // Pick which event happened, proportional to its rate
+        double pick = randomStateProbability(context -> rng) * totalRate;
+        int event = 0;
+        while (event < 3 && pick >= rates[event])
+        {
+            pick -= rates[event];
+            event++;
+        }
+
+        if (event == 0 || event == 1) {
+            scoreMatchGoal(context, event == 0 ? HOME_TEAM : AWAY_TEAM, minute);
+        } else {
+            injureRandomPlayer(context, event == 2 ? HOME_TEAM : AWAY_TEAM);
+        }
+    }
+}
+
+// Build a score sampler for a pairing of teams
+void initScoreSampler(ScoreSampler* sampler, Team* homeTeam, Team* awayTeam)
+{
+    // Validate input
+    if (sampler == NULL || homeTeam == NULL || awayTeam == NULL)
+    {
+        fprintf(stderr, "Error: Tried to build a score sampler for a sampler or team that doesn't exist.\n");
+        return;
+    }
+
+    sampler -> scoringProbability[HOME_TEAM] = calculateScoringProbability(homeTeam, awayTeam);
+    sampler -> scoringProbability[AWAY_TEAM] = calculateScoringProbability(awayTeam, homeTeam);
+
+    for (int teamIndex = HOME_TEAM; teamIndex <= AWAY_TEAM; teamIndex++)
+    {
+        for (int stoppage = 0; stoppage < NUM_PLAYED_LENGTHS; stoppage++)
+        {
+            sampler -> zeroProbability[teamIndex][stoppage] = 
+                pow(1.0 - sampler -> scoringProbability[teamIndex], MIN_PLAYED_MINUTES + stoppage);
+        }
+    }
+}
+
+// Sample the final score of a match between a sampler's teams
+void sampleScore(const ScoreSampler* sampler, RandomState* rng, int* score)
+{
+    // Both teams play the same minutes, the trials of both halves add up to one binomial
+    int stoppage = randomStateInt(rng, 0, MAX_STOPPAGE_TIME) + randomStateInt(rng, 0, MAX_STOPPAGE_TIME);
+
+    for (int teamIndex = HOME_TEAM; teamIndex <= AWAY_TEAM; teamIndex++)
+    {
+        score[teamIndex] = sampleGoals(rng, MIN_PLAYED_MINUTES + stoppage, sampler -> scoringProbability[teamIndex], 
+                                        sampler -> zeroProbability[teamIndex][stoppage]);
+    }
+}
+
+
+
+/* HELPER FUNCTIONS */
+
+// Helper function to pick the scorer (and assister) of a goal and record it
+static bool scoreMatchGoal(MatchContext* context, int teamIndex, int minute)
+{
+    Match* match = context -> match;
+    Team* team = (teamIndex == HOME_TEAM) ? match -> homeTeam : match -> awayTeam;
+
+    // Get the player who scored the goal & NULL check
+    Player* scorer = determineScorer(team, context -> rng);
+    if (scorer == NULL)
+    {
+        fprintf(stderr, "Error: Couldn't find a scorer for %s at %d'.\n", 
+                team -> name, minute);
+        return false;
+    }
+
+    // Recording goal for player & team
+    recordGoal(match, scorer, teamIndex, minute);
+
+    // Check for assist
+    Player* assister = determineAssist(team, scorer, context -> rng);
+    if (assister)
+    {
+        // Recording assist for player
+        assist(assister);
+    }
+
+    return true;
+}
+
+// Helper function to place goals on distinct minutes of a period, sorted ascending
+static int sampleGoalMinutes(RandomState* rng, int startMinute, int numMinutes, int numGoals, int* minutes)
+{
+    if (numGoals > MAX_PERIOD_GOALS) { numGoals = MAX_PERIOD_GOALS; }
+
+    // Floyd's algorithm: numGoals distinct offsets out of numMinutes in O(numGoals^2)
+    int count = 0;
+    for (int j = numMinutes - numGoals; j < numMinutes; j++)
+    {
+        int offset = randomStateInt(rng, 0, j);
+        for (int i = 0; i < count; i++)
+        {
+            if (minutes[i] == startMinute + offset)
             {
-                // Recording assist for player
-                assist(assister);
+                offset = j;
+                break;
             }
         }
+
+        // Insertion sort as we go, the lists are tiny
+        int minute = startMinute + offset;
+        int position = count;
+        while (position > 0 && minutes[position - 1] > minute)
+        {
+            minutes[position] = minutes[position - 1];
+            position--;
+        }
+        minutes[position] = minute;
+        count++;
+    }
+
+    return count;
+}
+
+// Helper function to simulate a period with the engine the match asked for
+static void simulatePeriod(MatchContext* context, int startMinute, int endMinute)
+{
+    if (context -> match -> engine == MATCH_ENGINE_BINOMIAL)
+    {
+        sampleMatchGoals(context, startMinute, endMinute);
+    }
+    else if (context -> match -> engine == MATCH_ENGINE_EVENT)
+    {
+        simulateMatchEvents(context, startMinute, endMinute);
+    }
+    else
+    {
+        simulateMatchMinutes(context, startMinute, endMinute);
+    }
+}
+
+// Helper function to count the players of a team who aren't injured
+static int countHealthyPlayers(const Team* team)
+{
+    int healthy = 0;
+    for (int i = 0; i < team -> numPlayers; i++)
+    {
+        healthy += (team -> roster[i].injured == false);
+    }
+    return healthy;
+}
+
+// Helper function to injure a uniformly chosen healthy player during play
+static void injureRandomPlayer(MatchContext* context, int teamIndex)
+{
+    Team* team = (teamIndex == HOME_TEAM) ? context -> match -> homeTeam : context -> match -> awayTeam;
+
+    int healthy = countHealthyPlayers(team);
+    if (healthy == 0) { return; }
+
+    // Walk to the chosen healthy player
+    int chosen = randomStateInt(context -> rng, 0, healthy - 1);
+    for (int i = 0; i < team -> numPlayers; i++)
+    {
+        if (team -> roster[i].injured == false && chosen-- == 0)
+        {
+            setPlayerInjuryStatus(team, team -> players[i] -> number, true);
+            break;
+        }
+    }
+
+    // The team changed, rates have to be recomputed before the next event
+    invalidateMatchContext(context);
+}
+
+// Helper function for how likely a player is to score, relative to teammates
+static double scoringWeight(const RosterEntry* entry)
+{
+    return entry -> rating * SCORING_POSITION_WEIGHT[entry -> position];
+}
+
+// Helper function for how likely a player is to assist, relative to teammates
+static double assistWeight(const RosterEntry* entry)
+{
+    return entry -> rating * ASSIST_POSITION_WEIGHT[entry -> position];
+}
+
+// Helper function to rebuild a team's scorer & assister alias tables, only
+// when its roster, ratings or injuries changed since they were last built
+static void refreshTeamSamplers(Team* team)
+{
+    if (team -> samplersDirty == false) { return; }
+
+    double* scorerWeights = prepareAliasTable(&team -> scorerTable, team -> numPlayers);
+    double* assistWeights = prepareAliasTable(&team -> assistTable, team -> numPlayers);
+    if (scorerWeights == NULL || assistWeights == NULL) { return; }
+
+    // Only the dense roster entries are read, never the Players themselves
+    for (int i = 0; i < team -> numPlayers; i++)
+    {
+        const RosterEntry* entry = &team -> roster[i];
+
+        // Injured players can't score or assist
+        bool available = (entry -> injured == false);
+        scorerWeights[i] = available ? scoringWeight(entry) : 0.0;
+        assistWeights[i] = available ? assistWeight(entry) : 0.0;
     }
-}
\ No newline at end of file
+
+    buildAliasTable(&team -> scorerTable);
+    buildAliasTable(&team -> assistTable);
+    team -> samplersDirty = false;
+}
+
+// Helper function to sample a team's goals over a match, the same binomial
+// draw as randomBinomial() with the chance of not scoring looked up instead of
+// recomputed
+static int sampleGoals(RandomState* rng, int numMinutes, double probability, double zeroProbability)
+{
+    // Walk up the CDF until it passes a single uniform draw
+    double u = randomStateProbability(rng);
+    double ratio = probability / (1.0 - probability);
+    double pmf = zeroProbability;
+    double cumulative = pmf;
+    int goals = 0;
+
+    while (u >= cumulative && goals < numMinutes)
+    {
+        pmf *= ratio * (double)(numMinutes - goals) / (double)(goals + 1);
+        cumulative += pmf;
+        goals++;
+    }
+
+    return goals;
+}
@@ -11,17 +11,76 @@
 /* INCLUDE STATEMENTS */
 
 #include "match.h"
+#include "random_utils.h"
+
+#define MAX_STOPPAGE_TIME 10            // Most stoppage time added to each half
+#define MIN_PLAYED_MINUTES 92           // Minutes simulated without stoppage time (46 per half)
+#define NUM_PLAYED_LENGTHS (2 * MAX_STOPPAGE_TIME + 1)  // Possible numbers of minutes simulated
 
 
 
 /* FUNCTION PROTOTYPES */
 
+/**
+ * ScoreSampler @struct the scoring rates of a pairing of teams, plus the chance
+ * of each team not scoring over each possible match length, so whole scores
+ * can be sampled many times over (Monte Carlo replicas) without a Match & with
+ * a couple of random draws per team
+ */
+typedef struct {
+    double scoringProbability[2];                       // Per minute scoring probability, indexed by HOME_TEAM/AWAY_TEAM
+    double zeroProbability[2][NUM_PLAYED_LENGTHS];      // Chance of not scoring, by stoppage time of the whole match
+} ScoreSampler;
+
+/**
+ * MatchContext @struct holding everything about a match that stays constant
+ * while it is being played, computed once at kick-off instead of every minute
+ */
+typedef struct {
+    Match* match;                   // Match being simulated
+    RandomState* rng;               // Random stream driving the simulation
+    RandomLanes lanes;              // Bulk lanes of the minute engine, seeded off rng on first use
+    bool lanesSeeded;               // Whether lanes has been seeded yet
+    double scoringProbability[2];   // Per minute scoring probability, indexed by HOME_TEAM/AWAY_TEAM
+    uint64_t scoringThreshold[2];   // Integer thresholds for the probabilities above
+    double goalHazard[2];           // Goals per minute, for the event engine
+    double injuryHazard[2];         // Injuries per minute across the healthy players, for the event engine
+    bool needsRefresh;              // Set when an in-match event (i.e. an injury) invalidates the rates
+} MatchContext;
+
+/**
+ * Build the context for a match that is about to be played
+ * 
+ * @param context that we are filling in
+ * @param match that is about to be played
+ * @param rng random stream that drives the simulation
+ * 
+ * @return boolean indicating success or failure to build the context
+ */
+bool initMatchContext(MatchContext* context, Match* match, RandomState* rng);
+
+/**
+ * Recompute the scoring rates of a match context from the current teams
+ * 
+ * @param context that we are refreshing
+ */
+void refreshMatchContext(MatchContext* context);
+
+/**
+ * Mark a match context as stale after an in-match event changed the teams,
+ * the rates get recomputed before the next minute is simulated
+ * 
+ * @param context that we are invalidating
+ */
+void invalidateMatchContext(MatchContext* context);
+
 /**
  * Simulate a complete match between two teams
  * 
  * @param match that we want to simulate
+ * @param rng random stream that drives the simulation
  */
-void simulateMatch(Match* match);
+void simulateMatch(Match* match, RandomState* rng);
 
 /**
  * Calculate the probability of two teams scoring based on ratings
@@ -35,38 +94,91 @@ void simulateMatch(Match* match);
 double calculateScoringProbability(Team* team, Team* opponentTeam);
 
 /**
- * Determine which player on the team scored the goal
+ * Determine which player on the team scored the goal. Draws from the team's
+ * cached alias table in O(1), rebuilding it first if the team changed
  * 
  * @param team that scored the goal
+ * @param rng random stream that drives the selection
  * 
  * @return pointer to the player who scored the goal for the team
  */
-Player* determineScorer(Team* team);
+Player* determineScorer(Team* team, RandomState* rng);
 
 /**
- * Determine which player assisted the goal (if applicable)
+ * Determine which player assisted the goal (if applicable). Draws from the
+ * team's cached alias table, redrawing if it lands on the scorer
  * 
  * @param team that scored the goal/scorer is on
  * @param scorer that made the goal
+ * @param rng random stream that drives the selection
  * 
  * @return pointer to the player who assisted the goal for the scorer
  */
-Player* determineAssist(Team* team, Player* scorer);
+Player* determineAssist(Team* team, Player* scorer, RandomState* rng);
 
 /**
  * Simulate any potential injuries that would occur during a match
  * 
  * @param match that we are simulating injuries in (if any)
+ * @param rng random stream that drives the simulation
  */
-void simulateInjuries(Match* match);
+void simulateInjuries(Match* match, RandomState* rng);
 
 /**
  * Simulate the minutes of a match, from start -> end
  * 
- * @param match that we are simulating the minutes of
+ * @param context of the match that we are simulating the minutes of
  * @param startMinute that we are beginning the period of play at
  * @param endMinute that we are ending the period of play at
  */
-void simulateMatchMinutes(Match* match, int startMinute, int endMinute);
+void simulateMatchMinutes(MatchContext* context, int startMinute, int endMinute);
+
+/**
+ * Simulate a period of a match by sampling each team's goal count directly
+ * from the binomial distribution of the minute by minute trials, then placing
+ * the goals on distinct minutes. Gives the same score distribution as
+ * simulateMatchMinutes() with a handful of random draws instead of two per
+ * minute (used by MATCH_ENGINE_BINOMIAL)
+ * 
+ * @param context of the match that we are simulating the period of
+ * @param startMinute that we are beginning the period of play at
+ * @param endMinute that we are ending the period of play at
+ */
+void sampleMatchGoals(MatchContext* context, int startMinute, int endMinute);
+
+/**
+ * Simulate a period of a match as a sequence of discrete events. The time to
+ * the next goal or injury is sampled from the teams' hazard rates and the
+ * simulation jumps straight to it, so a quiet period costs a few random
+ * draws. Injuries happen during play (and invalidate the context, so the
+ * rates get recomputed after them) instead of after the final whistle
+ * (used by MATCH_ENGINE_EVENT)
+ * 
+ * @param context of the match that we are simulating the period of
+ * @param startMinute that we are beginning the period of play at
+ * @param endMinute that we are ending the period of play at
+ */
+void simulateMatchEvents(MatchContext* context, int startMinute, int endMinute);
+
+/**
+ * Build a score sampler for a pairing of teams, from their current ratings
+ * 
+ * @param sampler that we are filling in
+ * @param homeTeam of the pairing
+ * @param awayTeam of the pairing
+ */
+void initScoreSampler(ScoreSampler* sampler, Team* homeTeam, Team* awayTeam);
+
+/**
+ * Sample the final score of a match between a sampler's teams: the stoppage
+ * time of both halves, then each team's goals from the same binomial
+ * distribution MATCH_ENGINE_BINOMIAL plays (ratings as they were when the
+ * sampler was built, no injuries). Touches neither the teams nor any match.
+ * 
+ * @param sampler of the pairing
+ * @param rng random stream that drives the sampling
+ * @param score -> Pointer to where we store the goals of each team, indexed by HOME_TEAM/AWAY_TEAM
+ */
+void sampleScore(const ScoreSampler* sampler, RandomState* rng, int* score);
 
 #endif /* MATCH_SIMULATION_H */
\ No newline at end of file
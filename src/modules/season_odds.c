@@ -0,0 +1,361 @@
+/**
+ * @author Javier A. Rodillas
+ * @details Implementation for the season odds module, which plays the rest of
+ *          a league's season many times over (Monte Carlo) without touching the
+ *          league, & ranks the replica tables in batches with the standings radix sort.
+ */
+
+
+
+/* INCLUDE STATEMENTS */
+
+#include "season_odds.h"
+#include "standings.h"
+#include "match_simulation.h"
+#include "random_utils.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ODDS_TABLE_POSITIONS 3      // Positions counted at either end of the table when printing
+
+
+
+/**
+ * ReplicaPlan @struct everything the replica seasons share, built once from the
+ * league (read only while the replicas run) plus each batch's counts
+ */
+typedef struct {
+    int numTeams;                   // Number of team slots
+    int numReplicas;                // Number of replica seasons
+    uint64_t seed;                  // Seed the replica streams are derived from
+    uint32_t streamId;              // Stream of the league within the run
+    const League* league;           // League whose ranking keys the replica tables are ranked by
+
+    // Standings at the start & current positions, by slot
+    const int* startPoints;
+    const int* startGoalDifference;
+    const int* startGoalsFor;
+
+    // Remaining fixtures
+    int numFixtures;
+    int* slots;                     // [fixture * 2 + HOME_TEAM/AWAY_TEAM] => team slot
+    int* fixedScores;               // [fixture * 2 + HOME_TEAM/AWAY_TEAM] => real score (-1 => sampled)
+    ScoreSampler* samplers;         // Score sampler of each fixture
+
+    // Results of each batch, merged once every batch is done
+    int* positionCounts;            // [batch * numTeams * numTeams + slot * numTeams + position]
+    long long* pointTotals;         // [batch * numTeams + slot]
+    bool* batchFailed;              // Batches that ran out of memory
+} ReplicaPlan;
+
+
+
+/* HELPER FUNCTION PROTOTYPE(s) */
+static bool initReplicaPlan(ReplicaPlan* plan, const League* league, int numReplicas, uint64_t seed);
+static void freeReplicaPlan(ReplicaPlan* plan);
+static void playReplicaBatch(void* context, int batch);
+
+
+
+/* FUNCTIONS */
+
+// Play the rest of a league's season many times over & count where each team finishes
+SeasonOdds* simulateSeasonOdds(const League* league, int numReplicas, uint64_t seed)
+{
+    // Validate input
+    if (league == NULL) {
+        fprintf(stderr, "Error: Cannot compute season odds for a NULL league.\n");
+        return NULL;
+    } else if (league -> scheduleGenerated == false) {
+        fprintf(stderr, "Error: Cannot compute season odds without a generated schedule.\n");
+        return NULL;
+    } else if (numReplicas <= 0) {
+        fprintf(stderr, "Error: Invalid number of replica seasons %d.\n", numReplicas);
+        return NULL;
+    }
+
+    // Replica tables are only ranked by their keys, rules past them aren't applied
+    if (getPackedTiebreakRules(league) < league -> numTiebreakRules)
+    {
+        fprintf(stderr, "Warning: %s breaks ties with rules the season odds don't apply (i.e. head-to-head), "
+                "teams level on points are ranked by their current position instead.\n", league -> name);
+    }
+
+    ReplicaPlan plan;
+    if (initReplicaPlan(&plan, league, numReplicas, seed) == false) { return NULL; }
+
+    // Play every batch of replicas, spread over the league's scheduler
+    int numBatches = (numReplicas + SEASON_ODDS_BATCH - 1) / SEASON_ODDS_BATCH;
+    runScheduler(league -> scheduler, playReplicaBatch, &plan, numBatches);
+
+    // Allocate memory for the odds & NULL check
+    int numTeams = plan.numTeams;
+    SeasonOdds* odds = (SeasonOdds*)malloc(sizeof(SeasonOdds));
+    if (odds != NULL)
+    {
+        odds -> positionCounts = (int*)calloc(numTeams * numTeams, sizeof(int));
+        odds -> expectedPoints = (double*)calloc(numTeams, sizeof(double));
+        if (odds -> positionCounts == NULL || odds -> expectedPoints == NULL)
+        {
+            destroySeasonOdds(odds);
+            odds = NULL;
+        }
+    }
+    if (odds == NULL)
+    {
+        fprintf(stderr, "Error: Failed to allocate memory for the season odds of %s.\n", league -> name);
+        freeReplicaPlan(&plan);
+        return NULL;
+    }
+
+    // Merge the batches in order (integer sums, so the thread count doesn't matter)
+    odds -> numTeams = numTeams;
+    odds -> numReplicas = numReplicas;
+    odds -> startMatchday = league -> currentMatchday;
+    long long* pointTotals = (long long*)calloc(numTeams, sizeof(long long));
+    bool failed = (pointTotals == NULL);
+
+    for (int batch = 0; batch < numBatches && failed == false; batch++)
+    {
+        failed = plan.batchFailed[batch];
+        const int* counts = &plan.positionCounts[(size_t)batch * numTeams * numTeams];
+        for (int i = 0; i < numTeams * numTeams; i++) { odds -> positionCounts[i] += counts[i]; }
+        for (int slot = 0; slot < numTeams; slot++) { pointTotals[slot] += plan.pointTotals[(size_t)batch * numTeams + slot]; }
+    }
+
+    if (failed == true)
+    {
+        fprintf(stderr, "Error: Ran out of memory playing the replica seasons of %s.\n", league -> name);
+        free(pointTotals);
+        destroySeasonOdds(odds);
+        freeReplicaPlan(&plan);
+        return NULL;
+    }
+
+    for (int slot = 0; slot < numTeams; slot++)
+    {
+        odds -> expectedPoints[slot] = (double)pointTotals[slot] / numReplicas;
+    }
+
+    free(pointTotals);
+    freeReplicaPlan(&plan);
+    return odds;
+}
+
+// Free all memory allocated for season odds
+void destroySeasonOdds(SeasonOdds* odds)
+{
+    if (odds == NULL) { return; }
+
+    free(odds -> positionCounts);
+    free(odds -> expectedPoints);
+    free(odds);
+}
+
+// Get the probability of a team finishing in a position
+double getPositionProbability(const SeasonOdds* odds, int slot, int position)
+{
+    if (odds == NULL || slot < 0 || slot >= odds -> numTeams || position < 1 || position > odds -> numTeams) {
+        return 0.0;
+    }
+
+    return (double)odds -> positionCounts[slot * odds -> numTeams + position - 1] / odds -> numReplicas;
+}
+
+// Print each team's expected points & title, top 3 & bottom 3 odds
+void printSeasonOdds(const League* league, const SeasonOdds* odds)
+{
+    // Validate input
+    if (league == NULL || odds == NULL || odds -> numTeams != league -> numTeams) {
+        fprintf(stderr, "Error: Cannot print season odds that don't belong to the league.\n");
+        return;
+    }
+
+    fprintf(stdout, "%s odds from matchday %d (%d replica seasons):\n",
+            league -> name, odds -> startMatchday + 1, odds -> numReplicas);
+    fprintf(stdout, "%-4s %-20s %-7s %-7s %-7s %-7s\n",
+            "Pos", "Team", "xPts", "Title", "Top 3", "Bot 3");
+    fprintf(stdout, "----------------------------------------------------------\n");
+
+    for (int position = 0; position < league -> numTeams; position++)
+    {
+        int slot = league -> table.order[position];
+        double top = 0.0, bottom = 0.0;
+        for (int i = 1; i <= ODDS_TABLE_POSITIONS && i <= odds -> numTeams; i++)
+        {
+            top += getPositionProbability(odds, slot, i);
+            bottom += getPositionProbability(odds, slot, odds -> numTeams + 1 - i);
+        }
+
+        fprintf(stdout, "%-4d %-20s %-7.1f %-7.3f %-7.3f %-7.3f\n",
+                position + 1, league -> teams[slot] -> name, odds -> expectedPoints[slot],
+                getPositionProbability(odds, slot, 1), top, bottom);
+    }
+}
+
+
+
+/* HELPER FUNCTIONS */
+
+// Helper function to build the shared plan of the replicas from the league
+static bool initReplicaPlan(ReplicaPlan* plan, const League* league, int numReplicas, uint64_t seed)
+{
+    const LeagueStandings* standings = &league -> standings;
+    int numTeams = league -> numTeams;
+    if (numTeams < 2 || standings -> numTeams != numTeams || league -> table.numTeams != numTeams)
+    {
+        fprintf(stderr, "Error: %s has no standings to compute season odds from.\n", league -> name);
+        return false;
+    }
+
+    memset(plan, 0, sizeof(ReplicaPlan));
+    plan -> numTeams = numTeams;
+    plan -> numReplicas = numReplicas;
+    plan -> seed = seed;
+    plan -> streamId = (uint32_t)league -> streamId;
+    plan -> league = league;
+    plan -> startPoints = standings -> points;
+    plan -> startGoalDifference = standings -> goalDifference;
+    plan -> startGoalsFor = standings -> goalsFor;
+
+    // The fixtures of every matchday still to be played are contiguous
+    int firstFixture = (league -> currentMatchday < league -> numMatchdays) ?
+                        league -> matchdayOffsets[league -> currentMatchday] : league -> numFixtures;
+    int numFixtures = league -> numFixtures - firstFixture;
+    int numBatches = (numReplicas + SEASON_ODDS_BATCH - 1) / SEASON_ODDS_BATCH;
+    int numSides = (numFixtures > 0) ? 2 * numFixtures : 1;
+
+    plan -> numFixtures = numFixtures;
+    plan -> slots = (int*)malloc(numSides * sizeof(int));
+    plan -> fixedScores = (int*)malloc(numSides * sizeof(int));
+    plan -> samplers = (ScoreSampler*)malloc(((numFixtures > 0) ? numFixtures : 1) * sizeof(ScoreSampler));
+    plan -> positionCounts = (int*)calloc((size_t)numBatches * numTeams * numTeams, sizeof(int));
+    plan -> pointTotals = (long long*)calloc((size_t)numBatches * numTeams, sizeof(long long));
+    plan -> batchFailed = (bool*)calloc(numBatches, sizeof(bool));
+    if (plan -> slots == NULL || plan -> fixedScores == NULL ||
+        plan -> samplers == NULL ||
+        plan -> positionCounts == NULL || plan -> pointTotals == NULL || plan -> batchFailed == NULL)
+    {
+        fprintf(stderr, "Error: Failed to allocate memory for %d replica seasons of %s.\n",
+                numReplicas, league -> name);
+        freeReplicaPlan(plan);
+        return false;
+    }
+
+    // Scoring rates only depend on the ratings, build each fixture's sampler once for every replica
+    for (int fixture = 0; fixture < numFixtures; fixture++)
+    {
+        const Match* match = &league -> fixtures[firstFixture + fixture];
+        plan -> slots[fixture * 2 + HOME_TEAM] = match -> homeSlot;
+        plan -> slots[fixture * 2 + AWAY_TEAM] = match -> awaySlot;
+        plan -> fixedScores[fixture * 2 + HOME_TEAM] = (match -> isCompleted == true) ? match -> homeScore : -1;
+        plan -> fixedScores[fixture * 2 + AWAY_TEAM] = (match -> isCompleted == true) ? match -> awayScore : -1;
+        initScoreSampler(&plan -> samplers[fixture], match -> homeTeam, match -> awayTeam);
+
+        if (match -> homeSlot < 0 || match -> awaySlot < 0)
+        {
+            fprintf(stderr, "Error: A fixture of %s has a team outside the league.\n", league -> name);
+            freeReplicaPlan(plan);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Helper function to free the memory of a replica plan
+static void freeReplicaPlan(ReplicaPlan* plan)
+{
+    free(plan -> slots);
+    free(plan -> fixedScores);
+    free(plan -> samplers);
+    free(plan -> positionCounts);
+    free(plan -> pointTotals);
+    free(plan -> batchFailed);
+    memset(plan, 0, sizeof(ReplicaPlan));
+}
+
+// Helper function to play one batch of replica seasons & rank their tables
+// together (a scheduler task)
+static void playReplicaBatch(void* context, int batch)
+{
+    ReplicaPlan* plan = (ReplicaPlan*)context;
+    int numTeams = plan -> numTeams;
+    int firstReplica = batch * SEASON_ODDS_BATCH;
+    int numTables = plan -> numReplicas - firstReplica;
+    if (numTables > SEASON_ODDS_BATCH) { numTables = SEASON_ODDS_BATCH; }
+
+    // Scratch standings of the replica being played & the keys of the whole batch
+    int* points = (int*)malloc(3 * numTeams * sizeof(int));
+    uint64_t* keys = (uint64_t*)malloc((size_t)numTables * numTeams * sizeof(uint64_t));
+    int* order = (int*)malloc((size_t)numTables * numTeams * sizeof(int));
+    if (points == NULL || keys == NULL || order == NULL)
+    {
+        plan -> batchFailed[batch] = true;
+        free(points);
+        free(keys);
+        free(order);
+        return;
+    }
+    int* goalDifference = points + numTeams;
+    int* goalsFor = points + 2 * numTeams;
+    long long* pointTotals = &plan -> pointTotals[(size_t)batch * numTeams];
+
+    for (int table = 0; table < numTables; table++)
+    {
+        memcpy(points, plan -> startPoints, numTeams * sizeof(int));
+        memcpy(goalDifference, plan -> startGoalDifference, numTeams * sizeof(int));
+        memcpy(goalsFor, plan -> startGoalsFor, numTeams * sizeof(int));
+
+        RandomState rng;
+        deriveRandomState(&rng, plan -> seed, plan -> streamId, SEASON_ODDS_STREAM_ROUND,
+                            (uint32_t)(firstReplica + table));
+
+        // Play out the remaining fixtures
+        for (int fixture = 0; fixture < plan -> numFixtures; fixture++)
+        {
+            int i = fixture * 2;
+            int score[2] = { plan -> fixedScores[i + HOME_TEAM], plan -> fixedScores[i + AWAY_TEAM] };
+            if (score[HOME_TEAM] < 0) { sampleScore(&plan -> samplers[fixture], &rng, score); }
+
+            int home = plan -> slots[i + HOME_TEAM];
+            int away = plan -> slots[i + AWAY_TEAM];
+            points[home] += (score[HOME_TEAM] > score[AWAY_TEAM]) ? 3 : (score[HOME_TEAM] == score[AWAY_TEAM]);
+            points[away] += (score[AWAY_TEAM] > score[HOME_TEAM]) ? 3 : (score[HOME_TEAM] == score[AWAY_TEAM]);
+            goalDifference[home] += score[HOME_TEAM] - score[AWAY_TEAM];
+            goalDifference[away] += score[AWAY_TEAM] - score[HOME_TEAM];
+            goalsFor[home] += score[HOME_TEAM];
+            goalsFor[away] += score[AWAY_TEAM];
+        }
+
+        uint64_t* tableKeys = &keys[(size_t)table * numTeams];
+        for (int slot = 0; slot < numTeams; slot++)
+        {
+            tableKeys[slot] = getRankingKey(plan -> league, slot, points[slot], goalDifference[slot], goalsFor[slot]);
+            pointTotals[slot] += points[slot];
+        }
+    }
+
+    // Rank every table of the batch at once, then count where each team finished
+    if (rankStandingsBatch(keys, numTables, numTeams, order) == false)
+    {
+        plan -> batchFailed[batch] = true;
+    }
+    else
+    {
+        int* counts = &plan -> positionCounts[(size_t)batch * numTeams * numTeams];
+        for (int table = 0; table < numTables; table++)
+        {
+            const int* tableOrder = &order[(size_t)table * numTeams];
+            for (int position = 0; position < numTeams; position++)
+            {
+                counts[tableOrder[position] * numTeams + position]++;
+            }
+        }
+    }
+
+    free(points);
+    free(keys);
+    free(order);
+}
@@ -0,0 +1,83 @@
+#ifndef SEASON_ODDS_H
+#define SEASON_ODDS_H
+
+/**
+ * @author Javier A. Rodillas
+ * @details Header file for the season odds (Monte Carlo) module.
+ */
+
+
+
+/* INCLUDE STATEMENTS & DEFINITIONS */
+#include "league.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SEASON_ODDS_BATCH 256               // Replica seasons ranked together (one scheduler task)
+#define SEASON_ODDS_STREAM_ROUND 0xFFFFFFFFu    // Round the replica streams are derived under (past any matchday)
+
+
+
+/* FUNCTION PROTOTYPES */
+
+/**
+ * SeasonOdds @struct outcome of many replica seasons played from the same
+ * point of a league's season. Slots are the teams' indices in league -> teams.
+ */
+typedef struct {
+    int numTeams;                   // Number of team slots
+    int numReplicas;                // Number of replica seasons played
+    int startMatchday;              // Matchday the replicas were played from
+    int* positionCounts;            // [slot * numTeams + position] => replicas the slot finished there (0 => top)
+    double* expectedPoints;         // Average final points of each slot
+} SeasonOdds;
+
+/**
+ * Play the rest of a league's season (from its current matchday) many times
+ * over & count where each team finishes. Replicas never touch the league, its
+ * teams or its matches: scores are sampled straight from each team's scoring
+ * rate (the same binomial distribution MATCH_ENGINE_BINOMIAL plays), with the
+ * ratings frozen as they are now (no injuries). Fixtures of the remaining
+ * matchdays that were already played count with their real score. Teams level
+ * on points are separated by goal difference & goals scored when the league's
+ * tiebreak rules start with them, then by their current position (head-to-head
+ * rules aren't applied, a warning is printed for leagues that use them). Replicas are spread over the league's scheduler in
+ * batches, each replica draws from its own stream, so the odds only depend on
+ * the seed.
+ *
+ * @param league with a generated schedule
+ * @param numReplicas number of seasons to play
+ * @param seed the replica streams are derived from
+ *
+ * @return pointer to the odds, NULL if they couldn't be computed
+ */
+SeasonOdds* simulateSeasonOdds(const League* league, int numReplicas, uint64_t seed);
+
+/**
+ * Free all memory allocated for season odds
+ *
+ * @param odds that we want to destroy
+ */
+void destroySeasonOdds(SeasonOdds* odds);
+
+/**
+ * Get the probability of a team finishing in a position
+ *
+ * @param odds that we are reading
+ * @param slot of the team (its index in league -> teams)
+ * @param position in the final table (1 => top)
+ *
+ * @return probability of the team finishing there, 0 for an invalid slot or position
+ */
+double getPositionProbability(const SeasonOdds* odds, int slot, int position);
+
+/**
+ * Print each team's expected points & title, top 3 & bottom 3 odds, in the
+ * order of the league's current table
+ *
+ * @param league the odds were computed for
+ * @param odds that we want to print
+ */
+void printSeasonOdds(const League* league, const SeasonOdds* odds);
+
+#endif // SEASON_ODDS_H
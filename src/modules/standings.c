@@ -0,0 +1,134 @@
+/**
+ * @author Javier A. Rodillas
+ * @details Implementation for the standings ranking module, which ranks league
+ *          tables through packed 64 bit keys & a radix sort instead of a comparator.
+ */
+
+
+
+/* INCLUDE STATEMENTS */
+
+#include "standings.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define RADIX_BITS 8                        // Bits of the key sorted per pass
+#define RADIX_BUCKETS (1 << RADIX_BITS)     // Buckets per pass
+
+
+
+/* HELPER FUNCTION PROTOTYPE(s) */
+static uint64_t clampKeyField(int value);
+
+/**
+ * RankEntry @struct pairing a key with where it came from while it is being sorted
+ */
+typedef struct {
+    uint64_t key;       // Inverted packed key (ascending sort => best team first)
+    int index;          // Index of the key in the batch
+} RankEntry;
+
+
+
+/* FUNCTIONS */
+
+// Pack a team's standings into a single 64 bit ranking key
+uint64_t packStandingsKey(int points, int goalDifference, int goalsScored, int tiebreak)
+{
+    return (clampKeyField(points) << 48)
+        | (clampKeyField(goalDifference + STANDINGS_GOAL_DIFFERENCE_BIAS) << 32)
+        | (clampKeyField(goalsScored) << 16)
+        | clampKeyField(tiebreak);
+}
+
+// Rank a batch of standings tables at once with an LSD radix sort over their packed keys
+bool rankStandingsBatch(const uint64_t* keys, int numTables, int numTeams, int* order)
+{
+    // Validate input
+    if (keys == NULL || order == NULL) {
+        fprintf(stderr, "Error: Cannot rank standings with NULL keys or order.\n");
+        return false;
+    } else if (numTables <= 0 || numTeams <= 0) {
+        fprintf(stderr, "Error: Cannot rank %d tables of %d teams.\n", numTables, numTeams);
+        return false;
+    }
+
+    int total = numTables * numTeams;
+    RankEntry* entries = (RankEntry*)malloc(total * sizeof(RankEntry));
+    RankEntry* scratch = (RankEntry*)malloc(total * sizeof(RankEntry));
+    int* filled = (int*)calloc(numTables, sizeof(int));
+    if (entries == NULL || scratch == NULL || filled == NULL)
+    {
+        fprintf(stderr, "Error: Failed to allocate memory for ranking %d tables.\n", numTables);
+        free(entries);
+        free(scratch);
+        free(filled);
+        return false;
+    }
+
+    // Invert the keys so that an ascending sort puts the best team first, and
+    // note which bits differ anywhere in the batch
+    uint64_t differingBits = 0;
+    for (int i = 0; i < total; i++)
+    {
+        entries[i].key = ~keys[i];
+        entries[i].index = i;
+        differingBits |= entries[i].key ^ entries[0].key;
+    }
+
+    // One stable counting sort per byte, least significant first, skipping bytes
+    // that every key shares (i.e. the high bytes of points & goals)
+    for (int shift = 0; shift < 64; shift += RADIX_BITS)
+    {
+        if (((differingBits >> shift) & (RADIX_BUCKETS - 1)) == 0) { continue; }
+
+        int counts[RADIX_BUCKETS] = { 0 };
+        for (int i = 0; i < total; i++)
+        {
+            counts[(entries[i].key >> shift) & (RADIX_BUCKETS - 1)]++;
+        }
+
+        int offset = 0;
+        for (int bucket = 0; bucket < RADIX_BUCKETS; bucket++)
+        {
+            int count = counts[bucket];
+            counts[bucket] = offset;
+            offset += count;
+        }
+
+        for (int i = 0; i < total; i++)
+        {
+            scratch[counts[(entries[i].key >> shift) & (RADIX_BUCKETS - 1)]++] = entries[i];
+        }
+
+        RankEntry* swap = entries;
+        entries = scratch;
+        scratch = swap;
+    }
+
+    // Final stable pass by table, every table has exactly numTeams entries so
+    // each one's output starts at table * numTeams
+    for (int i = 0; i < total; i++)
+    {
+        int table = entries[i].index / numTeams;
+        order[table * numTeams + filled[table]++] = entries[i].index % numTeams;
+    }
+
+    free(entries);
+    free(scratch);
+    free(filled);
+
+    return true;
+}
+
+
+
+/* HELPER FUNCTIONS */
+
+// Helper function to clamp a value into a 16 bit key field
+static uint64_t clampKeyField(int value)
+{
+    if (value < 0) { return 0; }
+    if (value > STANDINGS_KEY_FIELD_MAX) { return STANDINGS_KEY_FIELD_MAX; }
+    return (uint64_t)value;
+}
@@ -0,0 +1,56 @@
+#ifndef STANDINGS_H
+#define STANDINGS_H
+
+/**
+ * @author Javier A. Rodillas
+ * @details Header file for the standings ranking module.
+ */
+
+
+
+/* INCLUDE STATEMENTS & DEFINITIONS */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define STANDINGS_KEY_FIELD_MAX 0xFFFF      // Largest value each 16 bit field of a key can hold
+#define STANDINGS_GOAL_DIFFERENCE_BIAS 0x8000   // Added to the goal difference so it packs as unsigned
+
+
+
+/* FUNCTION PROTOTYPES */
+
+/**
+ * Pack a team's standings into a single 64 bit ranking key, so that comparing
+ * two keys as integers ranks the teams: a higher key ranks higher. From most to
+ * least significant, 16 bits each: points, goal difference (biased), goals
+ * scored, then a final tiebreak chosen by the caller (i.e. a higher value for
+ * the team that was higher in the table before). Out of range values are clamped.
+ *
+ * @param points of the team
+ * @param goalDifference of the team
+ * @param goalsScored by the team
+ * @param tiebreak used when everything else is level (0 - STANDINGS_KEY_FIELD_MAX)
+ *
+ * @return the packed ranking key
+ */
+uint64_t packStandingsKey(int points, int goalDifference, int goalsScored, int tiebreak);
+
+/**
+ * Rank a batch of standings tables at once with an LSD radix sort over their
+ * packed keys. Every table has the same number of teams, keys are laid out
+ * table by table (key of team slot s in table t at keys[t * numTeams + s]).
+ * Byte positions that are the same in every key of the batch are skipped, so
+ * a batch costs a few linear passes no matter how many tables it holds.
+ *
+ * @param keys from packStandingsKey(), numTables * numTeams of them
+ * @param numTables in the batch
+ * @param numTeams in each table
+ * @param order -> Pointer to where we store the slots of each table in ranking
+ *              order (order[t * numTeams + p] => slot in position p of table t)
+ *
+ * @return bool (true => ranked, false if the input was invalid or memory ran out)
+ */
+bool rankStandingsBatch(const uint64_t* keys, int numTables, int numTeams, int* order);
+
+#endif // STANDINGS_H
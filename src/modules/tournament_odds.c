@@ -0,0 +1,242 @@
+/**
+ * @author Javier A. Rodillas
+ * @details Implementation for the tournament odds module, which draws & plays a
+ *          tournament many times over (Monte Carlo) on arrays of team slots,
+ *          without touching the tournament or allocating any matches.
+ */
+
+
+
+/* INCLUDE STATEMENTS */
+
+#include "tournament_odds.h"
+#include "match_simulation.h"
+#include "random_utils.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+
+
+/**
+ * BracketPlan @struct everything the replica tournaments share, built once from
+ * the tournament (read only while the replicas run) plus each batch's counts
+ */
+typedef struct {
+    int numTeams;                   // Number of team slots
+    int numRounds;                  // Number of rounds of the bracket
+    int numReplicas;                // Number of replica tournaments
+    uint64_t seed;                  // Seed the replica streams are derived from
+    uint32_t streamId;              // Stream of the tournament within the run
+    ScoreSampler* samplers;         // [home * numTeams + away] => score sampler of the pairing
+    int* reachCounts;               // [batch * numTeams * (numRounds + 1) + slot * (numRounds + 1) + round]
+} BracketPlan;
+
+
+
+/* HELPER FUNCTION PROTOTYPE(s) */
+static void playReplicaBrackets(void* context, int batch);
+
+
+
+/* FUNCTIONS */
+
+// Draw & play a tournament many times over & count how far each team gets
+TournamentOdds* simulateTournamentOdds(const Tournament* tournament, int numReplicas, uint64_t seed)
+{
+    // Validate input
+    if (tournament == NULL) {
+        fprintf(stderr, "Error: Cannot compute odds for a NULL tournament.\n");
+        return NULL;
+    } else if (tournament->numTeams < 2 || (tournament->numTeams & (tournament->numTeams - 1)) != 0) {
+        fprintf(stderr, "Error: Number of teams must be a power of 2 (got %d).\n", tournament->numTeams);
+        return NULL;
+    } else if (numReplicas <= 0) {
+        fprintf(stderr, "Error: Invalid number of replica tournaments %d.\n", numReplicas);
+        return NULL;
+    }
+
+    int numTeams = tournament->numTeams;
+    int numRounds = (int)ceil(log2(numTeams));
+    if (numRounds > MAX_ROUNDS) { numRounds = MAX_ROUNDS; }
+    int numBatches = (numReplicas + TOURNAMENT_ODDS_BATCH - 1) / TOURNAMENT_ODDS_BATCH;
+    int countsPerBatch = numTeams * (numRounds + 1);
+
+    // Allocate memory for the odds & the plan, NULL check
+    TournamentOdds* odds = (TournamentOdds*)malloc(sizeof(TournamentOdds));
+    BracketPlan plan = { numTeams, numRounds, numReplicas, seed, (uint32_t)tournament->streamId, NULL, NULL };
+    if (odds != NULL)
+    {
+        odds->teams = (Team**)malloc(numTeams * sizeof(Team*));
+        odds->reachCounts = (int*)calloc(countsPerBatch, sizeof(int));
+    }
+    plan.samplers = (ScoreSampler*)malloc((size_t)numTeams * numTeams * sizeof(ScoreSampler));
+    plan.reachCounts = (int*)calloc((size_t)numBatches * countsPerBatch, sizeof(int));
+
+    if (odds == NULL || odds->teams == NULL || odds->reachCounts == NULL ||
+        plan.samplers == NULL || plan.reachCounts == NULL)
+    {
+        fprintf(stderr, "Error: Failed to allocate memory for %d replicas of %s.\n",
+                numReplicas, tournament->name);
+        destroyTournamentOdds(odds);
+        free(plan.samplers);
+        free(plan.reachCounts);
+        return NULL;
+    }
+
+    odds->numTeams = numTeams;
+    odds->numRounds = numRounds;
+    odds->numReplicas = numReplicas;
+    memcpy(odds->teams, tournament->teams, numTeams * sizeof(Team*));
+
+    // Scoring rates only depend on the ratings, build every pairing's sampler once
+    for (int home = 0; home < numTeams; home++)
+    {
+        for (int away = 0; away < numTeams; away++)
+        {
+            if (home != away) {
+                initScoreSampler(&plan.samplers[home * numTeams + away], tournament->teams[home], tournament->teams[away]);
+            }
+        }
+    }
+
+    // Play every batch of replicas, spread over the tournament's scheduler
+    runScheduler(tournament->scheduler, playReplicaBrackets, &plan, numBatches);
+
+    // Merge the batches in order
+    for (int batch = 0; batch < numBatches; batch++)
+    {
+        const int* counts = &plan.reachCounts[(size_t)batch * countsPerBatch];
+        for (int i = 0; i < countsPerBatch; i++) { odds->reachCounts[i] += counts[i]; }
+    }
+
+    free(plan.samplers);
+    free(plan.reachCounts);
+    return odds;
+}
+
+// Free all memory allocated for tournament odds
+void destroyTournamentOdds(TournamentOdds* odds)
+{
+    if (odds == NULL) { return; }
+
+    free(odds->teams);
+    free(odds->reachCounts);
+    free(odds);
+}
+
+// Get the probability of a team reaching a round
+double getRoundProbability(const TournamentOdds* odds, int slot, int round)
+{
+    if (odds == NULL || slot < 0 || slot >= odds->numTeams || round < 0 || round > odds->numRounds) {
+        return 0.0;
+    }
+
+    return (double)odds->reachCounts[slot * (odds->numRounds + 1) + round] / odds->numReplicas;
+}
+
+// Get the probability of a team winning the tournament
+double getWinProbability(const TournamentOdds* odds, int slot)
+{
+    return (odds != NULL) ? getRoundProbability(odds, slot, odds->numRounds) : 0.0;
+}
+
+// Print each team's probability of reaching every round & of winning, favourites first
+void printTournamentOdds(const TournamentOdds* odds)
+{
+    // NULL check odds
+    if (odds == NULL)
+    {
+        fprintf(stderr, "Error: Cannot print NULL tournament odds.\n");
+        return;
+    }
+
+    // Order the slots by their chance of winning (insertion sort, at most 32 teams)
+    int order[MAX_TEAMS_IN_TOURNAMENT];
+    for (int i = 0; i < odds->numTeams; i++)
+    {
+        int slot = i;
+        int j = i;
+        while (j > 0 && getWinProbability(odds, order[j - 1]) < getWinProbability(odds, slot))
+        {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = slot;
+    }
+
+    fprintf(stdout, "Tournament odds (%d replica draws):\n", odds->numReplicas);
+    fprintf(stdout, "%-20s ", "Team");
+    for (int round = 0; round < odds->numRounds; round++)
+    {
+        fprintf(stdout, "%-15s ", getRoundName(round, odds->numTeams));
+    }
+    fprintf(stdout, "%s\n", "Winner");
+    fprintf(stdout, "----------------------------------------------------------\n");
+
+    for (int i = 0; i < odds->numTeams; i++)
+    {
+        fprintf(stdout, "%-20s ", odds->teams[order[i]]->name);
+        for (int round = 0; round < odds->numRounds; round++)
+        {
+            fprintf(stdout, "%-15.3f ", getRoundProbability(odds, order[i], round));
+        }
+        fprintf(stdout, "%.3f\n", getWinProbability(odds, order[i]));
+    }
+}
+
+
+
+/* HELPER FUNCTIONS */
+
+// Helper function to draw & play one batch of replica tournaments on arrays of
+// slots (a scheduler task)
+static void playReplicaBrackets(void* context, int batch)
+{
+    BracketPlan* plan = (BracketPlan*)context;
+    int numTeams = plan->numTeams;
+    int numRounds = plan->numRounds;
+    int firstReplica = batch * TOURNAMENT_ODDS_BATCH;
+    int numBrackets = plan->numReplicas - firstReplica;
+    if (numBrackets > TOURNAMENT_ODDS_BATCH) { numBrackets = TOURNAMENT_ODDS_BATCH; }
+    int* counts = &plan->reachCounts[(size_t)batch * numTeams * (numRounds + 1)];
+
+    for (int bracket = 0; bracket < numBrackets; bracket++)
+    {
+        RandomState rng;
+        deriveRandomState(&rng, plan->seed, plan->streamId, TOURNAMENT_ODDS_STREAM_ROUND,
+                            (uint32_t)(firstReplica + bracket));
+
+        // Draw: the same Fisher-Yates shuffle as drawTournament(), on slots
+        int entrants[MAX_TEAMS_IN_TOURNAMENT];
+        for (int i = 0; i < numTeams; i++) { entrants[i] = i; }
+        for (int i = numTeams - 1; i > 0; i--)
+        {
+            int j = randomStateInt(&rng, 0, i);
+            int temp = entrants[i];
+            entrants[i] = entrants[j];
+            entrants[j] = temp;
+        }
+
+        // Each round pairs neighbours (first one at home), the winners move up in place
+        int numEntrants = numTeams;
+        for (int round = 0; round < numRounds; round++)
+        {
+            for (int i = 0; i < numEntrants / 2; i++)
+            {
+                int home = entrants[2 * i];
+                int away = entrants[2 * i + 1];
+                counts[home * (numRounds + 1) + round]++;
+                counts[away * (numRounds + 1) + round]++;
+
+                int score[2];
+                sampleScore(&plan->samplers[home * numTeams + away], &rng, score);
+                entrants[i] = (score[HOME_TEAM] > score[AWAY_TEAM]) ? home : away;
+            }
+            numEntrants /= 2;
+        }
+
+        counts[entrants[0] * (numRounds + 1) + numRounds]++;
+    }
+}
@@ -0,0 +1,91 @@
+#ifndef TOURNAMENT_ODDS_H
+#define TOURNAMENT_ODDS_H
+
+/**
+ * @author Javier A. Rodillas
+ * @details Header file for the tournament odds (Monte Carlo) module.
+ */
+
+
+
+/* INCLUDE STATEMENTS & DEFINITIONS */
+#include "tournament.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#define TOURNAMENT_ODDS_BATCH 1024              // Replica tournaments counted together (one scheduler task)
+#define TOURNAMENT_ODDS_STREAM_ROUND 0xFFFFFFFEu    // Round the replica streams are derived under (past any real round)
+
+
+
+/* FUNCTION PROTOTYPES */
+
+/**
+ * TournamentOdds @struct outcome of many replica draws & brackets of the same
+ * tournament. Slots are the teams' indices in teams (the tournament's order
+ * when the odds were computed, a later draw shuffles the tournament's own).
+ */
+typedef struct {
+    Team** teams;                   // Team of each slot (not owned)
+    int numTeams;                   // Number of team slots
+    int numRounds;                  // Number of rounds of the bracket
+    int numReplicas;                // Number of replica tournaments played
+    int* reachCounts;               // [slot * (numRounds + 1) + round] => replicas the slot played in round (numRounds => won it)
+} TournamentOdds;
+
+/**
+ * Draw & play a tournament many times over & count how far each team gets.
+ * Replicas never touch the tournament, its teams or its bracket, & don't
+ * allocate any matches: every replica shuffles the teams like drawTournament()
+ * & walks the bracket on an array of slots, sampling each score straight from
+ * the teams' scoring rates (the same binomial distribution MATCH_ENGINE_BINOMIAL
+ * plays, ratings frozen as they are now, no injuries). A drawn match sends the
+ * away team through, like simulateTournamentRound(). Replicas are spread over
+ * the tournament's scheduler in batches, each replica draws from its own
+ * stream, so the odds only depend on the seed.
+ *
+ * @param tournament whose teams we want the odds of (a power of 2 of them)
+ * @param numReplicas number of draws & brackets to play
+ * @param seed the replica streams are derived from
+ *
+ * @return pointer to the odds, NULL if they couldn't be computed
+ */
+TournamentOdds* simulateTournamentOdds(const Tournament* tournament, int numReplicas, uint64_t seed);
+
+/**
+ * Free all memory allocated for tournament odds (not the teams)
+ *
+ * @param odds that we want to destroy
+ */
+void destroyTournamentOdds(TournamentOdds* odds);
+
+/**
+ * Get the probability of a team reaching a round
+ *
+ * @param odds that we are reading
+ * @param slot of the team
+ * @param round of the bracket (0-based, numRounds => winning the tournament)
+ *
+ * @return probability of the team reaching the round, 0 for an invalid slot or round
+ */
+double getRoundProbability(const TournamentOdds* odds, int slot, int round);
+
+/**
+ * Get the probability of a team winning the tournament
+ *
+ * @param odds that we are reading
+ * @param slot of the team
+ *
+ * @return probability of the team winning, 0 for an invalid slot
+ */
+double getWinProbability(const TournamentOdds* odds, int slot);
+
+/**
+ * Print each team's probability of reaching every round (named with
+ * getRoundName()) & of winning, favourites first
+ *
+ * @param odds that we want to print
+ */
+void printTournamentOdds(const TournamentOdds* odds);
+
+#endif // TOURNAMENT_ODDS_H
@@ -12,6 +12,30 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <ctype.h>
+
+
+
+/**
+ * PositionAlias @struct mapping one accepted spelling of a position to its enum
+ */
+typedef struct
+{
+    const char* name;   // Lower case spelling of the position
+    Position position;  // Position it stands for
+} PositionAlias;
+
+static const PositionAlias POSITION_ALIASES[] = {
+    { "gkp", POSITION_GKP }, { "gk", POSITION_GKP },
+    { "def", POSITION_DEF }, { "cb", POSITION_DEF }, { "lb", POSITION_DEF }, 
+    { "rb", POSITION_DEF }, { "lwb", POSITION_DEF }, { "rwb", POSITION_DEF },
+    { "mid", POSITION_MID }, { "cm", POSITION_MID }, { "cdm", POSITION_MID }, 
+    { "cam", POSITION_MID }, { "lm", POSITION_MID }, { "rm", POSITION_MID },
+    { "fwd", POSITION_FWD }, { "st", POSITION_FWD }, { "cf", POSITION_FWD }, 
+    { "lw", POSITION_FWD }, { "rw", POSITION_FWD }
+};
+
+static const char* POSITION_NAMES[NUM_POSITIONS] = { "gkp", "def", "mid", "fwd" };
 
 
 
@@ -20,6 +44,15 @@
 // Create a new player with all of their attributes
 Player* createPlayer(int number, const char* position, const char* name, int rating)
 {
+    // Parse the position before allocating anything
+    Position parsedPosition;
+    if (parsePosition(position, &parsedPosition) == false)
+    {
+        fprintf(stderr, "Error: Unknown position '%s' for %s.\n", 
+                (position != NULL) ? position : "(null)", (name != NULL) ? name : "(null)");
+        return NULL;
+    }
+
     // Allocate memory for a player
     Player* player = (Player*)malloc(sizeof(Player));
 
@@ -32,9 +65,7 @@ Player* createPlayer(int number, const char* position, const char* name, int rat
     // Initialize player attributes
     player -> number = number;      // Number
 
-    // Position
-    strncpy(player -> position, position, sizeof(player -> position) - 1);
-    player -> position[sizeof(player -> position) - 1] = '\0';  // Ensure null termination
+    player -> position = parsedPosition;    // Position
 
     // Name
     strncpy(player -> name, name, sizeof(player -> name) - 1);
@@ -48,6 +79,41 @@ Player* createPlayer(int number, const char* position, const char* name, int rat
     return player;
 }
 
+// Parse a position string
+bool parsePosition(const char* name, Position* position)
+{
+    if (name == NULL || position == NULL) { return false; }
+
+    // Lower case copy of the name, no accepted spelling is longer than 3 characters
+    char lower[4];
+    size_t length = strlen(name);
+    if (length == 0 || length >= sizeof(lower)) { return false; }
+    for (size_t i = 0; i <= length; i++)
+    {
+        lower[i] = (char)tolower((unsigned char)name[i]);
+    }
+
+    // Look the spelling up
+    for (size_t i = 0; i < sizeof(POSITION_ALIASES) / sizeof(POSITION_ALIASES[0]); i++)
+    {
+        if (strcmp(lower, POSITION_ALIASES[i].name) == 0)
+        {
+            *position = POSITION_ALIASES[i].position;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Get the short name of a position
+const char* getPositionName(Position position)
+{
+    if (position < 0 || position >= NUM_POSITIONS) { return "???"; }
+
+    return POSITION_NAMES[position];
+}
+
 // Free up memory allocated for a player
 void destroyPlayer(Player* player)
 {
@@ -108,7 +174,7 @@ void printPlayer(const Player* player)
             stdout, 
             "%s, number %d: \n\t%d overall %s \n\t%d Goals, %d Assists \n\tInjury Status: %s.\n", 
             player -> name, player -> number, player -> rating, 
-            player -> position, player -> goals, player -> assists, 
+            getPositionName(player -> position), player -> goals, player -> assists, 
             injuryReport
         );
     }
@@ -134,9 +200,7 @@ Player* copyPlayer(const Player* src, Player* dest)
     // Copying Attributes
     dest -> number = src -> number;             // Number
 
-    // Position
-    strncpy(dest -> position, src -> position, sizeof(src -> position) - 1);
-    dest -> position[sizeof(src -> position) - 1] = '\0';
+    dest -> position = src -> position;         // Position
 
     // Name
     strncpy(dest -> name, src -> name, sizeof(src -> name) - 1);
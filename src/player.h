@@ -16,13 +16,25 @@
 
 /* FUNCTION PROTOTYPES */
 
+/**
+ * Position @enum of a player, parsed once from a string when the player is created
+ */
+typedef enum
+{
+    POSITION_GKP,       // Goal keeper (gkp, gk)
+    POSITION_DEF,       // Defender (def, cb, lb, rb, lwb, rwb)
+    POSITION_MID,       // Midfielder (mid, cm, cdm, cam, lm, rm)
+    POSITION_FWD,       // Forward (fwd, st, cf, lw, rw)
+    NUM_POSITIONS       // Number of positions, for tables indexed by position
+} Position;
+
 /**
  * Player @struct representing a football player
  */
 typedef struct
 {
     int number;         // Number on the back of their jersey
-    char position[4];   // Position can be represented by atmost a 3 character string (extra byte for null terminator)
+    Position position;  // Position the player plays on the roster
     char name[50];      // Last name of the player (i.e. 'Lionel Messi' as 'Messi')
     int rating;         // Player rating (1 - 100)
     int goals;          // Goals scored
@@ -34,12 +46,34 @@ typedef struct
  * Create a new player with all of their attributes
  * 
  * @param number on the back of the player's jersey
- * @param position -> Pointer to the position of the player on the roster
+ * @param position -> Pointer to the position of the player on the roster (see parsePosition())
  * @param name -> Pointer to the last name of the player
  * @param rating of the player (1 - 100)
+ * 
+ * @return pointer to the new Player, NULL if the position is not recognized
  */
 Player* createPlayer(int number, const char* position, const char* name, int rating);
 
+/**
+ * Parse a position string, case insensitive, e.g. "gkp"/"gk", "def"/"cb",
+ * "mid"/"cam" or "fwd"/"st"
+ * 
+ * @param name of the position
+ * @param position -> Pointer to where we store the parsed position
+ * 
+ * @return bool (true => recognized position, false otherwise)
+ */
+bool parsePosition(const char* name, Position* position);
+
+/**
+ * Get the short name of a position
+ * 
+ * @param position that we want the name of
+ * 
+ * @return "gkp", "def", "mid", "fwd" (or "???" for an invalid position)
+ */
+const char* getPositionName(Position position);
+
 /**
  * Free up memory allocated for a player
  * 
@@ -15,6 +15,16 @@
 
 
 
+/* HELPER FUNCTION PROTOTYPE(s) */
+static int findNameBucket(const Team* team, const char* name);
+static int findRosterBucket(const Team* team, int index);
+static void insertNameBucket(Team* team, int index);
+static void eraseNameBucket(Team* team, int bucket);
+static void moveRosterIndex(Team* team, int from, int to);
+static void removePlayerAt(Team* team, int index);
+
+
+
 /* FUNCTIONS */
 
 // Create a new team
@@ -49,14 +59,23 @@ Team* createTeam(const char* name, const char* city, const char* coach, const ch
     team -> homeStadium[sizeof(team -> homeStadium) - 1] = '\0';    // Ensure null termination
 
     // Team Roster
-    team -> maxPlayers = 25;    // Default max roster size of 25
+    team -> maxPlayers = DEFAULT_MAX_PLAYERS;
     team -> numPlayers = 0;
     team -> players = (Player**)malloc(sizeof(Player*) * team -> maxPlayers);
+    team -> roster = (RosterEntry*)malloc(sizeof(RosterEntry) * team -> maxPlayers);
+    for (int number = 0; number <= MAX_JERSEY_NUMBER; number++) { team -> jerseySlots[number] = -1; }
+    for (int bucket = 0; bucket < ROSTER_NAME_BUCKETS; bucket++) { team -> nameSlots[bucket] = -1; }
+    team -> stableRosterOrder = false;
 
     // Rest of the fields & their default values
     team -> rating = 0.0;
+    team -> ratingSum = 0;
+    initAliasTable(&team -> scorerTable);
+    initAliasTable(&team -> assistTable);
+    team -> samplersDirty = true;
     team -> schedule = NULL;
     team -> scheduleLength = 0;
+    team -> leagueSlot = -1;
 
     team -> wins = 0;
     team -> losses = 0;
@@ -89,12 +108,17 @@ void destroyTeam(Team* team)
             // Free the array containing the roster
             free(team -> players);
         }
+        free(team -> roster);
 
         // Free the schedule if it exists
         if (team -> schedule != NULL)
         {
             free(team -> schedule);
         }
+
+        // Free the samplers
+        freeAliasTable(&team -> scorerTable);
+        freeAliasTable(&team -> assistTable);
         
         // Free the team itself now
         free(team);
@@ -127,23 +151,35 @@ bool addPlayer(Team* team, Player* player)
         return false;
     }
     
+    // Check that the number is a valid jersey number
+    if (player -> number < 0 || player -> number > MAX_JERSEY_NUMBER)
+    {
+        fprintf(stderr, "Error: %s's number %d is not a jersey number (0 - %d)!\n", 
+                player -> name, player -> number, MAX_JERSEY_NUMBER);
+        return false;
+    }
+
     // Check to see if a player on the roster with that number already exists or not
-    for (int i = 0; i < team -> numPlayers; i++)
+    if (team -> jerseySlots[player -> number] != -1)
     {
-        if (team -> players[i] -> number == player -> number)
-        {
-            fprintf(stderr, "Error: %s's number is already taken by %s on %s!\n", 
-                    player -> name, team -> players[i] -> name, team -> name);
-            return false;
-        }
+        fprintf(stderr, "Error: %s's number is already taken by %s on %s!\n", 
+                player -> name, team -> players[team -> jerseySlots[player -> number]] -> name, team -> name);
+        return false;
     }
 
-    // Add player to roster and increment roster size
+    // Add player to roster (& its jersey & name tables) and increment roster size
     team -> players[team -> numPlayers] = player;
+    team -> roster[team -> numPlayers].rating = (int16_t)player -> rating;
+    team -> roster[team -> numPlayers].position = (uint8_t)player -> position;
+    team -> roster[team -> numPlayers].injured = player -> injuryStatus;
+    team -> jerseySlots[player -> number] = team -> numPlayers;
+    insertNameBucket(team, team -> numPlayers);
     team -> numPlayers++;
 
-    // Calculate new team rating
-    team -> rating = calculateTeamRating(team);
+    // Update team rating
+    team -> ratingSum += player -> rating;
+    team -> rating = (float)team -> ratingSum / team -> numPlayers;
+    team -> samplersDirty = true;
     
     return true;
 }
@@ -159,17 +195,7 @@ bool removePlayerByNumber(Team* team, int number)
     }
 
     // Find player with given number
-    int playerIndex = -1;
-    for (int i = 0; i < team -> numPlayers; i++)
-    {
-        // If we find a player with the given number
-        if (team -> players[i] -> number == number)
-        {
-            // Remember the index that we found him at
-            playerIndex = i;
-            break;
-        }
-    }
+    int playerIndex = (number >= 0 && number <= MAX_JERSEY_NUMBER) ? team -> jerseySlots[number] : -1;
     
     // If there is no player with the number, give error
     if (playerIndex < 0)
@@ -179,20 +205,8 @@ bool removePlayerByNumber(Team* team, int number)
         return false;
     }
     
-    // Free the OLD player with the number
-    destroyPlayer(team -> players[playerIndex]);
-
-    // Shift players in roster to fill the gap
-    for (int i = playerIndex; i < team -> numPlayers - 1; i++)
-    {
-        team -> players[i] = team -> players[i + 1];
-    }
-
-    // Update the number of players on the team
-    team -> numPlayers--;
-
-    // Re-calculate the team rating
-    team -> rating = calculateTeamRating(team);
+    // Free the player & fill the gap they left in the roster
+    removePlayerAt(team, playerIndex);
 
     return true;
 }
@@ -208,20 +222,15 @@ bool removePlayerByName(Team* team, char* name)
     }
     
 
-    // Find player with given name
-    int playerIndex = -1;
-    for (int i = 0; i < team -> numPlayers; i++)
+    // Null check name
+    if (name == NULL)
     {
-        int isTheSame = -1;
-        isTheSame = strcmp(team -> players[i] -> name, name);
-        // If we find a player with the given name
-        if (isTheSame == 0)
-        {
-            // Remember the index that we found him at
-            playerIndex = i;
-            break;
-        }
+        fprintf(stderr, "Error: Trying to remove a player with a NULL name from %s.\n", team -> name);
+        return false;
     }
+
+    // Find player with given name
+    int playerIndex = team -> nameSlots[findNameBucket(team, name)];
     
     // If there is no player with the given name, give error
     if (playerIndex < 0)
@@ -231,20 +240,8 @@ bool removePlayerByName(Team* team, char* name)
         return false;
     }
     
-    // Free the OLD player with the number
-    destroyPlayer(team -> players[playerIndex]);
-
-    // Shift players in roster to fill the gap
-    for (int i = playerIndex; i < team -> numPlayers - 1; i++)
-    {
-        team -> players[i] = team -> players[i + 1];
-    }
-    
-    // Update the number of players on the team
-    team -> numPlayers--;
-
-    // Re-calculate the team rating
-    team -> rating = calculateTeamRating(team);
+    // Free the player & fill the gap they left in the roster
+    removePlayerAt(team, playerIndex);
 
     return true;
 }
@@ -260,45 +257,135 @@ Player* getPlayerByNumber(const Team* team, int number)
     }
 
     // Find player w/given jersey number
-    for (int i = 0; i < team -> numPlayers; i++)
+    if (number < 0 || number > MAX_JERSEY_NUMBER || team -> jerseySlots[number] == -1)
     {
-        // If we find a player with the given number
-        if (team -> players[i] -> number == number)
-        {
-            return team -> players[i];
-        }
+        // Player not found
+        return NULL;
     }
 
-    // Player not found
-    return NULL;
+    return team -> players[team -> jerseySlots[number]];
 }
 
-// Calculate the teams overall rating (based on team average)
-float calculateTeamRating(Team* team)
+// Get a player by their name
+Player* getPlayerByName(const Team* team, const char* name)
+{
+    // Null check team & name
+    if (team == NULL || name == NULL)
+    {
+        fprintf(stderr, "Error: Trying to find a player by name with a NULL team or name.\n");
+        return NULL;
+    }
+
+    int playerIndex = team -> nameSlots[findNameBucket(team, name)];
+    return (playerIndex != -1) ? team -> players[playerIndex] : NULL;
+}
+
+// Choose how removing a player fills the gap in the roster
+void setStableRosterOrder(Team* team, bool stable)
+{
+    if (team == NULL) { return; }
+
+    team -> stableRosterOrder = stable;
+}
+
+// Change the rating of a player on the team, keeping the team rating in sync
+bool setPlayerRating(Team* team, int number, int rating)
 {
     // Null check team
     if (team == NULL)
     {
-        fprintf(stderr, "Error: Tried to calculate rating of a team that doesn't exist.\n");
+        fprintf(stderr, "Error: Tried to change a player's rating on a team that doesn't exist.\n");
+        return false;
+    }
+
+    // Find the player
+    Player* player = getPlayerByNumber(team, number);
+    if (player == NULL)
+    {
+        fprintf(stderr, "Error: There was no player found with the number %d on %s.\n", 
+                number, team -> name);
+        return false;
+    }
+
+    // Swap the old rating for the new one in the team rating
+    team -> ratingSum += rating - player -> rating;
+    player -> rating = rating;
+    team -> roster[team -> jerseySlots[number]].rating = (int16_t)rating;
+    team -> rating = (float)team -> ratingSum / team -> numPlayers;
+    team -> samplersDirty = true;
+
+    return true;
+}
+
+// Change the injury status of a player on the team
+bool setPlayerInjuryStatus(Team* team, int number, bool status)
+{
+    // Null check team
+    if (team == NULL)
+    {
+        fprintf(stderr, "Error: Tried to change a player's injury status on a team that doesn't exist.\n");
+        return false;
+    }
+
+    // Find the player
+    Player* player = getPlayerByNumber(team, number);
+    if (player == NULL)
+    {
+        fprintf(stderr, "Error: There was no player found with the number %d on %s.\n", 
+                number, team -> name);
+        return false;
+    }
+
+    // Only an actual change invalidates the samplers
+    if (player -> injuryStatus != status)
+    {
+        updateInjuryStatus(player, status);
+        team -> roster[team -> jerseySlots[number]].injured = status;
+        team -> samplersDirty = true;
+    }
+
+    return true;
+}
+
+// Get the teams overall rating (based on team average)
+float getTeamRating(const Team* team)
+{
+    // Null check team
+    if (team == NULL)
+    {
+        fprintf(stderr, "Error: Tried to get the rating of a team that doesn't exist.\n");
         return 0.0;
     }
 
-    // Check for if/when a team has 0 players (avoid division by 0)
-    if (team -> numPlayers == 0)
+    return team -> rating;
+}
+
+// Recalculate the teams overall rating (based on team average) from scratch
+float calculateTeamRating(Team* team)
+{
+    // Null check team
+    if (team == NULL)
     {
+        fprintf(stderr, "Error: Tried to calculate rating of a team that doesn't exist.\n");
         return 0.0;
     }
-    
 
-    // Sum up total ratings
+    // Sum up total ratings, refreshing the roster entries from the players on the way
     int total_ratings = 0;
     for (int i = 0; i < team -> numPlayers; i++)
     {
-        total_ratings += team -> players[i] -> rating;
+        const Player* player = team -> players[i];
+        team -> roster[i].rating = (int16_t)player -> rating;
+        team -> roster[i].position = (uint8_t)player -> position;
+        team -> roster[i].injured = player -> injuryStatus;
+        total_ratings += player -> rating;
     }
+    team -> ratingSum = total_ratings;
 
-    // Divide by the total number of players
-    return (float)total_ratings / team -> numPlayers;
+    // Divide by the total number of players (avoid division by 0 for an empty team)
+    team -> rating = (team -> numPlayers > 0) ? (float)total_ratings / team -> numPlayers : 0.0f;
+    team -> samplersDirty = true;
+    return team -> rating;
 }
 
 // Update the record & points of a team
@@ -412,4 +499,118 @@ void printTeam(const Team* team, bool showPlayers)
     }
     
     fprintf(stdout, "\n");
-}
\ No newline at end of file
+}
+
+
+
+/* HELPER FUNCTIONS */
+
+// Helper function to find the bucket holding a player with a name, or the
+// empty bucket that ends its probe sequence
+static int findNameBucket(const Team* team, const char* name)
+{
+    int bucket = (int)(hashName(name) & (ROSTER_NAME_BUCKETS - 1));
+    while (team -> nameSlots[bucket] != -1 && strcmp(team -> players[team -> nameSlots[bucket]] -> name, name) != 0)
+    {
+        bucket = (bucket + 1) & (ROSTER_NAME_BUCKETS - 1);
+    }
+
+    return bucket;
+}
+
+// Helper function to find the bucket holding a roster index (players sharing
+// a name share a probe sequence, so match on the index itself)
+static int findRosterBucket(const Team* team, int index)
+{
+    int bucket = (int)(hashName(team -> players[index] -> name) & (ROSTER_NAME_BUCKETS - 1));
+    while (team -> nameSlots[bucket] != index)
+    {
+        bucket = (bucket + 1) & (ROSTER_NAME_BUCKETS - 1);
+    }
+
+    return bucket;
+}
+
+// Helper function to put a roster index in the first empty bucket of its name's probe sequence
+static void insertNameBucket(Team* team, int index)
+{
+    int bucket = (int)(hashName(team -> players[index] -> name) & (ROSTER_NAME_BUCKETS - 1));
+    while (team -> nameSlots[bucket] != -1)
+    {
+        bucket = (bucket + 1) & (ROSTER_NAME_BUCKETS - 1);
+    }
+
+    team -> nameSlots[bucket] = index;
+}
+
+// Helper function to empty a bucket, shifting later entries of the probe
+// sequence back so that none of them becomes unreachable (no tombstones)
+static void eraseNameBucket(Team* team, int bucket)
+{
+    int gap = bucket;
+    for (int next = (gap + 1) & (ROSTER_NAME_BUCKETS - 1); team -> nameSlots[next] != -1; 
+         next = (next + 1) & (ROSTER_NAME_BUCKETS - 1))
+    {
+        // An entry can fill the gap unless its home bucket lies (cyclically) in (gap, next]
+        int home = (int)(hashName(team -> players[team -> nameSlots[next]] -> name) & (ROSTER_NAME_BUCKETS - 1));
+        int distanceToHome = (next - home) & (ROSTER_NAME_BUCKETS - 1);
+        int distanceToGap = (next - gap) & (ROSTER_NAME_BUCKETS - 1);
+        if (distanceToHome >= distanceToGap)
+        {
+            team -> nameSlots[gap] = team -> nameSlots[next];
+            gap = next;
+        }
+    }
+
+    team -> nameSlots[gap] = -1;
+}
+
+// Helper function to point the jersey & name tables at a player that moved
+// from one roster index to another (already stored at players[to])
+static void moveRosterIndex(Team* team, int from, int to)
+{
+    int bucket = (int)(hashName(team -> players[to] -> name) & (ROSTER_NAME_BUCKETS - 1));
+    while (team -> nameSlots[bucket] != from)
+    {
+        bucket = (bucket + 1) & (ROSTER_NAME_BUCKETS - 1);
+    }
+
+    team -> nameSlots[bucket] = to;
+    team -> jerseySlots[team -> players[to] -> number] = to;
+}
+
+// Helper function to free the player at a roster index & fill the gap, either
+// with the last player or by shifting everyone after it (stable roster order)
+static void removePlayerAt(Team* team, int index)
+{
+    Player* player = team -> players[index];
+
+    // Take the player out of the tables & the team rating, then free them
+    eraseNameBucket(team, findRosterBucket(team, index));
+    team -> jerseySlots[player -> number] = -1;
+    team -> ratingSum -= player -> rating;
+    destroyPlayer(player);
+
+    int last = team -> numPlayers - 1;
+    if (team -> stableRosterOrder == true) {
+        // Shift players in roster to fill the gap
+        for (int i = index; i < last; i++)
+        {
+            team -> players[i] = team -> players[i + 1];
+            team -> roster[i] = team -> roster[i + 1];
+            moveRosterIndex(team, i + 1, i);
+        }
+    } else if (index != last) {
+        // Move the last player into the gap
+        team -> players[index] = team -> players[last];
+        team -> roster[index] = team -> roster[last];
+        moveRosterIndex(team, last, index);
+    }
+
+    // Update the number of players on the team
+    team -> numPlayers--;
+
+    // Update the team rating (samplers are indexed like the roster, so they are rebuilt)
+    team -> rating = (team -> numPlayers > 0) ? (float)team -> ratingSum / team -> numPlayers : 0.0f;
+    team -> samplersDirty = true;
+}
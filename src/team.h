@@ -11,12 +11,32 @@
 /* INCLUDE STATEMENTS */
 
 #include "player.h"
+#include "alias_table.h"
+#include "name_index.h"
 #include <stdbool.h>
+#include <stdint.h>
+
+#define DEFAULT_MAX_PLAYERS 25      // Roster size of a new team
+#define MAX_JERSEY_NUMBER 99        // Jersey numbers run from 0 to this
+#define ROSTER_NAME_BUCKETS 64      // Buckets of a roster's name table (power of two, at least twice the roster)
 
 
 
 /* FUNCTION PROTOTYPES */
 
+/**
+ * RosterEntry @struct copy of the player fields the simulation reads in every
+ * match, packed into 4 bytes & kept in an array parallel to the roster. Sweeps
+ * over a team (sampler builds, injury checks) then read one or two cache lines
+ * instead of following a pointer to every Player. Kept in sync by the team's
+ * roster, rating & injury functions.
+ */
+typedef struct {
+    int16_t rating;         // Rating of the player
+    uint8_t position;       // Position of the player (a Position)
+    bool injured;           // Injury status of the player
+} RosterEntry;
+
 /**
  * Team @struct to represent a club football team
  */
@@ -32,14 +52,25 @@ typedef struct
     Player** players;       // Array of pointers to Player structs
     int numPlayers;         // Number of players currently on the team
     int maxPlayers;         // Maximum number of players a team can have
+    RosterEntry* roster;    // Hot simulation fields of each player, indexed like players
+    int jerseySlots[MAX_JERSEY_NUMBER + 1];     // Roster index of each jersey number (-1 => free)
+    int nameSlots[ROSTER_NAME_BUCKETS];         // Open addressing table of roster indices by player name (-1 => empty)
+    bool stableRosterOrder; // Removals shift the roster to keep its order (false => the last player fills the gap)
 
     // Schedule
     // @attention: NO METHOD IN THIS CLASS TO CHANGE THIS
     int* schedule;          // Array of indices (of teams) in the order they play
     int scheduleLength;     // Length of schedule (alternatively, number of games)
+    int leagueSlot;         // Index of the team in its league's teams array (-1 => not in a league)
 
     // Rating
-    float rating;           // Overall rating (average) of the team
+    float rating;           // Overall rating (average) of the team, kept up to date by the roster functions
+    int ratingSum;          // Sum of every player's rating on the roster
+
+    // Samplers (built & used by the match simulation module)
+    AliasTable scorerTable; // Who scores a goal, indexed like the roster
+    AliasTable assistTable; // Who assists a goal, indexed like the roster
+    bool samplersDirty;     // True when the roster, ratings or injuries changed since the last build
 
     // Record
     int wins;               // Games won
@@ -75,7 +106,8 @@ Team* createTeam(const char* name, const char* city, const char* coach, const ch
 void destroyTeam(Team* team);
 
 /**
- * Add a player to a team
+ * Add a player to a team. Their jersey number (0 - MAX_JERSEY_NUMBER) must not
+ * be taken by anyone else on the roster
  * 
  * @param Team to add a player to
  * @param Player to add to our team
@@ -85,7 +117,9 @@ void destroyTeam(Team* team);
 bool addPlayer(Team* team, Player* player);
 
 /**
- * Remove a specific player from a team, searching for them by number
+ * Remove a specific player from a team, searching for them by number. The
+ * last player on the roster takes their place unless the team keeps a stable
+ * roster order (see setStableRosterOrder())
  * 
  * @param Team to remove a player from
  * @param int jersery number of the player we want to remove from the team
@@ -95,7 +129,8 @@ bool addPlayer(Team* team, Player* player);
 bool removePlayerByNumber(Team* team, int number);
 
 /**
- * Remove a specific player from a team, searching for them by name
+ * Remove a specific player from a team, searching for them by name (in O(1)
+ * through the roster's name table), filling the gap like removePlayerByNumber()
  * 
  * @param Team to remove a player from
  * @param name of the player that we are looking to remove from the team
@@ -105,7 +140,7 @@ bool removePlayerByNumber(Team* team, int number);
 bool removePlayerByName(Team* team, char* name);
 
 /**
- * Get a player by their jersey number
+ * Get a player by their jersey number, in O(1) through the roster's jersey table
  * 
  * @param Team that we are searching in
  * @param int jersey number that we are looking for
@@ -116,9 +151,69 @@ bool removePlayerByName(Team* team, char* name);
 Player* getPlayerByNumber(const Team* team, int number);
 
 /**
- * Calculate the teams overall rating (based on team average)
+ * Get a player by their name, in O(1) through the roster's name table. If
+ * several players share a name, one of them is returned.
+ * 
+ * @param Team that we are searching in
+ * @param name of the player that we are looking for
+ * 
+ * @return pointer to the player that we have found, NULL if there is none
+ */
+Player* getPlayerByName(const Team* team, const char* name);
+
+/**
+ * Choose how removing a player fills the gap in the roster: by moving the last
+ * player into it (O(1), the default) or by shifting everyone after it down to
+ * keep the roster order
+ * 
+ * @param Team that we want to set the removal order of
+ * @param bool stable (true => keep the roster order, false => swap in the last player)
+ */
+void setStableRosterOrder(Team* team, bool stable);
+
+/**
+ * Change the rating of a player on the team, keeping the team rating in sync
+ * 
+ * @param Team that the player is on
+ * @param int jersey number of the player
+ * @param int new rating of the player (1 - 100)
+ * 
+ * @return bool (true => rating changed, false otherwise)
+ */
+bool setPlayerRating(Team* team, int number, int rating);
+
+/**
+ * Change the injury status of a player on the team, so that the team knows to
+ * rebuild its scorer & assister samplers
+ * 
+ * @param Team that the player is on
+ * @param int jersey number of the player
+ * @param bool status (true => injured, false => healthy)
+ * 
+ * @return bool (true => status changed, false otherwise)
+ */
+bool setPlayerInjuryStatus(Team* team, int number, bool status);
+
+/**
+ * Get the teams overall rating (based on team average). The rating is kept
+ * up to date by addPlayer(), the removePlayer functions and setPlayerRating(),
+ * so this is a plain read
+ * 
+ * @param Team that we want the rating of
+ * 
+ * @return float the average rating of the roster
+ */
+float getTeamRating(const Team* team);
+
+/**
+ * Recalculate the teams overall rating (based on team average) from scratch.
+ * Only needed after a player's rating or injury status was changed directly
+ * on the Player (also copies them into the roster entries & marks the
+ * samplers for a rebuild)
  * 
  * @param Team that we are calculating the rating of
+ * 
+ * @return float the average rating of the roster
  */
 float calculateTeamRating(Team* team);
 
@@ -23,6 +23,7 @@
 bool advanceTeam(Tournament* tournament, int round, int matchIndex);
 void destroyBracket(Tournament* tournament);
 bool isPowerOfTwo(int n);
+static void simulateBracketMatch(void* context, int index);
 
 
 
@@ -54,17 +55,26 @@ Tournament* createTournament(const char* name)
 
     // Teams
     tournament -> numTeams = 0;
+    tournament -> nameIndex = getDefaultNameIndex();
+    initNameSlotMap(&tournament -> teamSlots);
 
     // Bracket
     tournament -> bracket = NULL;
     tournament -> numRounds = 0;
     tournament -> matchesPerRound = NULL;
     tournament -> currentRound = 0;
+    initArena(&tournament -> arena, 0);
 
     // Results
     tournament -> winner = NULL;
     tournament -> isComplete = false;
 
+    // Seed the tournament's match streams from the default stream
+    tournament -> seed = randomNext(getDefaultRandomState());
+    tournament -> streamId = 0;
+    tournament -> matchEngine = MATCH_ENGINE_MINUTE;
+    tournament -> scheduler = NULL;
+
     return tournament;
 }
 
@@ -76,9 +86,11 @@ void destroyTournament(Tournament* tournament)
 
     // Free teams array (but not the teams themselves, as they might be used elsewhere)
     free(tournament->teams);
+    freeNameSlotMap(&tournament->teamSlots);
 
-    // Free bracket if it exists
+    // Free bracket if it exists, along with the arena it lived in
     destroyBracket(tournament);
+    freeArena(&tournament -> arena);
 
     // Free the tournament struct
     free(tournament);
@@ -105,16 +117,19 @@ bool addTeamToTournament(Tournament* tournament, Team* team)
     }
 
     // Check if team already exists in the tournament
-    for (int i = 0; i < tournament->numTeams; i++)
-    {
-        if (strcmp(tournament->teams[i]->name, team->name) == 0)
-        {
-            fprintf(stderr, "Error: Team '%s' is already in the tournament.\n", team->name);
-            return false;
-        }
+    int nameId = internName(tournament->nameIndex, team->name);
+    if (nameId == -1) {
+        return false;
+    } else if (getNameSlot(&tournament->teamSlots, nameId) != -1) {
+        fprintf(stderr, "Error: Team '%s' is already in the tournament.\n", team->name);
+        return false;
     }
 
     // Add team to the tournament
+    if (setNameSlot(&tournament->teamSlots, nameId, tournament->numTeams) == false)
+    {
+        return false;
+    }
     tournament->teams[tournament->numTeams] = team;
     tournament->numTeams++;
 
@@ -134,15 +149,8 @@ bool removeTeamFromTournament(Tournament* tournament, const char* teamName)
     }
 
     // Find the team
-    int teamIndex = -1;
-    for (int i = 0; i < tournament->numTeams; i++)
-    {
-        if (strcmp(tournament->teams[i]->name, teamName) == 0)
-        {
-            teamIndex = i;
-            break;
-        }
-    }
+    int nameId = findNameId(tournament->nameIndex, teamName);
+    int teamIndex = getNameSlot(&tournament->teamSlots, nameId);
 
     // If we couldn't find the team
     if (teamIndex == -1)
@@ -152,9 +160,11 @@ bool removeTeamFromTournament(Tournament* tournament, const char* teamName)
     }
 
     // Shift teams left to fill the gap
+    setNameSlot(&tournament->teamSlots, nameId, -1);
     for (int i = teamIndex; i < tournament->numTeams - 1; i++)
     {
         tournament->teams[i] = tournament->teams[i + 1];
+        setNameSlot(&tournament->teamSlots, findNameId(tournament->nameIndex, tournament->teams[i]->name), i);
     }
 
     // Decrement our counter of the number of teams left in the tournament
@@ -163,13 +173,111 @@ bool removeTeamFromTournament(Tournament* tournament, const char* teamName)
     return true;
 }
 
+// Get a team from the tournament by the id of its name
+Team* getTournamentTeamByNameId(const Tournament* tournament, int nameId)
+{
+    // NULL check tournament
+    if (tournament == NULL)
+    {
+        fprintf(stderr, "Error: Cannot find a team in a NULL tournament.\n");
+        return NULL;
+    }
+
+    int teamIndex = getNameSlot(&tournament->teamSlots, nameId);
+    return (teamIndex != -1) ? tournament->teams[teamIndex] : NULL;
+}
+
+// Choose the name index the tournament interns its team names into
+bool setTournamentNameIndex(Tournament* tournament, NameIndex* index)
+{
+    // NULL check tournament
+    if (tournament == NULL)
+    {
+        fprintf(stderr, "Error: Cannot set the name index of a NULL tournament.\n");
+        return false;
+    }
+
+    // Ids differ between indices, so map every team again
+    tournament->nameIndex = (index != NULL) ? index : getDefaultNameIndex();
+    freeNameSlotMap(&tournament->teamSlots);
+    for (int i = 0; i < tournament->numTeams; i++)
+    {
+        int nameId = internName(tournament->nameIndex, tournament->teams[i]->name);
+        if (nameId == -1 || setNameSlot(&tournament->teamSlots, nameId, i) == false)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Set the seed the tournament derives its match streams from
+void setTournamentSeed(Tournament* tournament, uint64_t seed, int streamId)
+{
+    // NULL check tournament
+    if (tournament == NULL)
+    {
+        fprintf(stderr, "Error: Cannot set the seed of a NULL tournament.\n");
+        return;
+    }
+
+    tournament->seed = seed;
+    tournament->streamId = streamId;
+}
+
+// Choose a scheduler to simulate each round's matches on
+void setTournamentScheduler(Tournament* tournament, Scheduler* scheduler)
+{
+    // NULL check tournament
+    if (tournament == NULL)
+    {
+        fprintf(stderr, "Error: Cannot set the scheduler of a NULL tournament.\n");
+        return;
+    }
+
+    tournament->scheduler = scheduler;
+}
+
+// Choose the engine used to simulate the tournament's matches
+void setTournamentMatchEngine(Tournament* tournament, MatchEngine engine)
+{
+    // NULL check tournament
+    if (tournament == NULL)
+    {
+        fprintf(stderr, "Error: Cannot set the match engine of a NULL tournament.\n");
+        return;
+    }
+
+    tournament->matchEngine = engine;
+
+    // Apply to matches that were already drawn
+    if (tournament->bracket != NULL)
+    {
+        for (int round = 0; round < tournament->numRounds; round++)
+        {
+            for (int i = 0; i < tournament->matchesPerRound[round]; i++)
+            {
+                if (tournament->bracket[round][i] != NULL)
+                {
+                    tournament->bracket[round][i]->engine = engine;
+                }
+            }
+        }
+    }
+}
+
 // Seed/draw teams into the tournament bracket
-bool drawTournament(Tournament* tournament)
+bool drawTournament(Tournament* tournament, RandomState* rng)
 {
     // Validate input
     if (tournament == NULL) {
         fprintf(stderr, "Error: Cannot draw NULL tournament.\n");
         return false;
+    } else if (rng == NULL) {
+        fprintf(stderr, "Error: Cannot draw %s without a random stream.\n", 
+                tournament->name);
+        return false;
     } else if (tournament->numTeams < 2) {
         // Need at least 2 teams to create a tournament
         fprintf(stderr, "Error: Need at least 2 teams to draw a tournament.\n");
@@ -194,8 +302,8 @@ bool drawTournament(Tournament* tournament)
     tournament->winner = NULL;
     tournament->isComplete = false;
 
-    // Allocate memory for the bracket & NULL check
-    tournament->bracket = (Match***)malloc(tournament->numRounds * sizeof(Match**));
+    // Allocate memory for the bracket from the tournament's arena & NULL check
+    tournament->bracket = (Match***)arenaAlloc(&tournament->arena, tournament->numRounds * sizeof(Match**));
     if (tournament->bracket == NULL)
     {
         fprintf(stderr, "Error: Failed to allocate memory for tournament bracket.\n");
@@ -203,12 +311,11 @@ bool drawTournament(Tournament* tournament)
     }
 
     // Allocate memory for matchesPerRound and NULL check
-    tournament->matchesPerRound = (int*)malloc(tournament->numRounds * sizeof(int));
+    tournament->matchesPerRound = (int*)arenaAlloc(&tournament->arena, tournament->numRounds * sizeof(int));
     if (tournament->matchesPerRound == NULL)
     {
         fprintf(stderr, "Error: Failed to allocate memory for matchesPerRound.\n");
-        free(tournament->bracket);
-        tournament->bracket = NULL;
+        destroyBracket(tournament);
         return false;
     }
 
@@ -224,21 +331,24 @@ bool drawTournament(Tournament* tournament)
     // Shuffle teams for random draw Fisher-Yates shuffle algorithm
     for (int i = tournament->numTeams - 1; i > 0; i--)
     {
-        int j = rand() % (i + 1);
+        int j = randomStateInt(rng, 0, i);
         Team* temp = tournament->teams[i];
         tournament->teams[i] = tournament->teams[j];
         tournament->teams[j] = temp;
     }
 
+    // Keep the name index pointing at where the draw put each team
+    for (int i = 0; i < tournament->numTeams; i++)
+    {
+        setNameSlot(&tournament->teamSlots, findNameId(tournament->nameIndex, tournament->teams[i]->name), i);
+    }
+
     // Allocate memory for the first round matches & NULL check
-    tournament->bracket[0] = (Match**)malloc(tournament->matchesPerRound[0] * sizeof(Match*));
+    tournament->bracket[0] = (Match**)arenaAlloc(&tournament->arena, tournament->matchesPerRound[0] * sizeof(Match*));
     if (tournament->bracket[0] == NULL)
     {
         fprintf(stderr, "Error: Failed to allocate memory for first round matches.\n");
-        free(tournament->matchesPerRound);
-        free(tournament->bracket);
-        tournament->bracket = NULL;
-        tournament->matchesPerRound = NULL;
+        destroyBracket(tournament);
         return false;
     }
 
@@ -250,25 +360,18 @@ bool drawTournament(Tournament* tournament)
         sprintf(dateStr, "R1-M%d", i + 1);
         
         // Create match
-        Match* match =  createMatch(tournament->teams[teamIndex], 
-                                    tournament->teams[teamIndex + 1], 
-                                    dateStr);
+        Match* match =  createMatchInArena(&tournament->arena, 
+                                            tournament->teams[teamIndex], 
+                                            tournament->teams[teamIndex + 1], 
+                                            dateStr);
         if (match == NULL)
         {
             fprintf(stderr, "Error: Failed to create match for first round.\n");
-            // Clean up
-            for (int j = 0; j < i; j++)
-            {
-                destroyMatch(tournament->bracket[0][j]);
-            }
-            free(tournament->bracket[0]);
-            free(tournament->matchesPerRound);
-            free(tournament->bracket);
-            tournament->bracket = NULL;
-            tournament->matchesPerRound = NULL;
+            destroyBracket(tournament);
             return false;
         }
         
+        match->engine = tournament->matchEngine;
         tournament->bracket[0][i] = match;
         teamIndex += 2;
     }
@@ -276,27 +379,11 @@ bool drawTournament(Tournament* tournament)
     // Allocate memory for subsequent rounds & NULL check
     for (int round = 1; round < tournament->numRounds; round++)
     {
-        tournament->bracket[round] = (Match**)malloc(tournament->matchesPerRound[round] * sizeof(Match*));
+        tournament->bracket[round] = (Match**)arenaAlloc(&tournament->arena, tournament->matchesPerRound[round] * sizeof(Match*));
         if (tournament->bracket[round] == NULL)
         {
             fprintf(stderr, "Error: Failed to allocate memory for round %d matches.\n", round+1);
-            // Look at each round in the tournament up to the current one
-            for (int i = 0; i < round; i++)
-            {
-                // Free each match in the round
-                for (int j = 0; j < tournament->matchesPerRound[i]; j++)
-                {
-                    destroyMatch(tournament->bracket[i][j]);
-                }
-                // Free the ith round of the bracket
-                free(tournament->bracket[i]);
-            }
-
-            // Free the bracket and the matches per round array
-            free(tournament->matchesPerRound);
-            free(tournament->bracket);
-            tournament->bracket = NULL;
-            tournament->matchesPerRound = NULL;
+            destroyBracket(tournament);
             return false;
         }
         
@@ -328,25 +415,31 @@ bool simulateTournamentRound(Tournament* tournament, int round)
 
     fprintf(stdout, "Simulating %s of %s...\n", getRoundName(round, tournament->numTeams), tournament->name);
 
-    // Simulate all matches for the current round
+    // Report matches that were already played, they are skipped
+    bool alreadyPlayed[MAX_TEAMS_IN_TOURNAMENT / 2];
     for (int i = 0; i < tournament->matchesPerRound[round]; i++)
     {
         Match* match = tournament->bracket[round][i];
-        
-        // Skip already played matches
-        if (match->isCompleted)
+        alreadyPlayed[i] = match->isCompleted;
+        if (alreadyPlayed[i])
         {
             fprintf(stdout, "Match between %s and %s was already played.\n", 
                     match->homeTeam->name, match->awayTeam->name);
-            continue;
         }
-        
-        // Simulate the match
-        simulateMatch(match);
-        
-        // Print the result
-        fprintf(stdout, "  ");
-        printMatchResult(match);
+    }
+
+    // Simulate all matches for the current round, forked onto the tournament's
+    // scheduler if it has one (no two matches of a round share a team)
+    runScheduler(tournament->scheduler, simulateBracketMatch, tournament, tournament->matchesPerRound[round]);
+
+    // Print the results, in bracket order
+    for (int i = 0; i < tournament->matchesPerRound[round]; i++)
+    {
+        if (alreadyPlayed[i] == false)
+        {
+            fprintf(stdout, "  ");
+            printMatchResult(tournament->bracket[round][i]);
+        }
     }
 
     // If this is not the final round, create matches for the next round
@@ -401,7 +494,7 @@ bool simulateTournamentRound(Tournament* tournament, int round)
                 sprintf(dateStr, "R%d-M%d", round+2, i+1);
                 
                 // Create match & NULL check
-                Match* match = createMatch(team1, team2, dateStr);
+                Match* match = createMatchInArena(&tournament->arena, team1, team2, dateStr);
                 if (match == NULL)
                 {
                     fprintf(stderr, "Error: Failed to create match for round %d.\n", round+2);
@@ -409,6 +502,7 @@ bool simulateTournamentRound(Tournament* tournament, int round)
                 }
                 
                 // Set the match in the next round of the bracket
+                match->engine = tournament->matchEngine;
                 tournament->bracket[round+1][i] = match;
             }
         }
@@ -734,7 +828,7 @@ bool advanceTeam(Tournament* tournament, int round, int matchIndex)
         sprintf(dateStr, "R%d-M%d", round+2, nextRoundMatchIndex+1);
         
         // Create match with winner as home team (second winner will be away team)
-        Match* nextMatch = createMatch(winner, NULL, dateStr);
+        Match* nextMatch = createMatchInArena(&tournament->arena, winner, NULL, dateStr);
         if (nextMatch == NULL)
         {
             fprintf(stderr, "Error: Failed to create match for round %d.\n", round+2);
@@ -758,34 +852,28 @@ bool advanceTeam(Tournament* tournament, int round, int matchIndex)
 // Helper function to free the bracket from memory
 void destroyBracket(Tournament* tournament)
 {
-    // Free bracket if it exists
-    if (tournament->bracket != NULL)
-    {
-        // Look at each round in the tournament
-        for (int i = 0; i < tournament->numRounds; i++)
-        {
-            // If the bracket exists for that round, free it
-            if (tournament->bracket[i] != NULL)
-            {
-                // Free each match in the round
-                for (int j = 0; j < tournament->matchesPerRound[i]; j++)
-                {
-                    destroyMatch(tournament->bracket[i][j]);
-                }
-
-                // Free the ith round of the bracket
-                free(tournament->bracket[i]);
-            }
-        }
-
-        // Free the bracket and the matches per round array
-        free(tournament->bracket);
-        free(tournament->matchesPerRound);
-    }
+    // Every round, match & spilled goal came from the arena, release them all at once
+    resetArena(&tournament->arena);
+    tournament->bracket = NULL;
+    tournament->matchesPerRound = NULL;
 }
 
 // Function to detect if a number is a power of two
 bool isPowerOfTwo(int n)
 {
     return n > 0 && (n & (n - 1)) == 0;
-}
\ No newline at end of file
+}
+
+// Helper function to simulate one match of the current round, with its own
+// (seed, tournament, round, match) stream (a scheduler task)
+static void simulateBracketMatch(void* context, int index)
+{
+    Tournament* tournament = (Tournament*)context;
+    Match* match = tournament->bracket[tournament->currentRound][index];
+    if (match->isCompleted) { return; }
+
+    RandomState matchRng;
+    deriveRandomState(&matchRng, tournament->seed, (uint32_t)tournament->streamId, 
+                        (uint32_t)tournament->currentRound, (uint32_t)index);
+    simulateMatch(match, &matchRng);
+}
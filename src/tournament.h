@@ -13,6 +13,10 @@
 #include "team.h"
 #include "match.h"
 #include "modules/match_simulation.h"
+#include "random_utils.h"
+#include "arena.h"
+#include "name_index.h"
+#include "scheduler.h"
 #include <stdbool.h>
 
 #define MAX_TOURNAMENT_NAME_LENGTH 50
@@ -26,16 +30,25 @@ typedef struct {
     // Roster of teams
     Team** teams;                           // Array of teams in the tournament
     int numTeams;                           // Number of teams in the tournament
+    NameIndex* nameIndex;                   // Index the team names are interned into (shareable with leagues)
+    NameSlotMap teamSlots;                  // Index in teams of each team by its name id in nameIndex
 
     // Bracket
     Match*** bracket;                       // 3D array: [round][match]
     int numRounds;                          // Number of rounds in the tournament
     int* matchesPerRound;                   // Number of matches for each round
     int currentRound;                       // Current round (0-based)
+    Arena arena;                            // Memory for the bracket, its matches & their goals (released all at once)
 
     // Results
     Team* winner;                           // Tournament winner
     bool isComplete;                        // Flag if tournament is complete
+
+    // Simulation
+    uint64_t seed;                          // Seed every match stream is derived from
+    int streamId;                           // Index of this tournament within the run
+    MatchEngine matchEngine;                // Engine used for every match of the tournament
+    Scheduler* scheduler;                   // Scheduler a round's matches are simulated on (NULL => one after another)
 } Tournament;
 
 
@@ -79,14 +92,66 @@ bool addTeamToTournament(Tournament* tournament, Team* team);
  */
 bool removeTeamFromTournament(Tournament* tournament, const char* teamName);
 
+/**
+ * Get a team from the tournament by the id of its name in the tournament's name index
+ * 
+ * @param tournament that we want to get the team from
+ * @param nameId of the team (see internName() / findNameId())
+ * 
+ * @return pointer to the team, NULL if no team of the tournament has that name
+ */
+Team* getTournamentTeamByNameId(const Tournament* tournament, int nameId);
+
+/**
+ * Choose the name index the tournament interns its team names into (see
+ * setLeagueNameIndex()). Tournaments use getDefaultNameIndex() unless given
+ * another one.
+ * 
+ * @param tournament that we want to set the name index of
+ * @param index to intern team names into (NULL => getDefaultNameIndex())
+ * 
+ * @return boolean indicating success or failure to re-index the tournament's teams
+ */
+bool setTournamentNameIndex(Tournament* tournament, NameIndex* index);
+
+/**
+ * Set the seed the tournament derives its match streams from. Each match
+ * draws from the stream keyed by (seed, streamId, round, match index).
+ * 
+ * @param tournament that we want to seed
+ * @param seed of the simulation run
+ * @param streamId index of the tournament within the run
+ */
+void setTournamentSeed(Tournament* tournament, uint64_t seed, int streamId);
+
+/**
+ * Choose the engine used to simulate the tournament's matches
+ * 
+ * @param tournament that we want to set the engine of
+ * @param engine used for every match (MATCH_ENGINE_MINUTE by default)
+ */
+void setTournamentMatchEngine(Tournament* tournament, MatchEngine engine);
+
+/**
+ * Choose a scheduler to simulate each round's matches on. The matches of a
+ * round involve disjoint teams and each draws from its own stream, so the
+ * results are the same as simulating them one after another.
+ * 
+ * @param tournament that we want to set the scheduler of
+ * @param scheduler to run the matches on (NULL => simulate them one after another),
+ *        not owned by the tournament
+ */
+void setTournamentScheduler(Tournament* tournament, Scheduler* scheduler);
+
 /**
  * Seed/draw teams into the tournament bracket
  * 
  * @param tournament that we want to make team & seed drawings for
+ * @param rng random stream used to shuffle the teams
  * 
  * @return boolean indicating success or failure to make a drawing
  */
-bool drawTournament(Tournament* tournament);
+bool drawTournament(Tournament* tournament, RandomState* rng);
 
 /**
  * Simulate a specific round of the tournament
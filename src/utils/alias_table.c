@@ -0,0 +1,167 @@
+/**
+ * @author  Javier A. Rodillas
+ * @details Class implementation of the alias table utility class.
+ *
+ * @cite    Walker's alias method, built with Vose's O(n) algorithm:
+ *          https://www.keithschwarz.com/darts-dice-coins/
+ */
+
+/* INCLUDE STATEMENTS */
+
+#include "alias_table.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+
+
+/* FUNCTIONS */
+
+// Initialize an empty alias table
+void initAliasTable(AliasTable* table)
+{
+    if (table == NULL) { return; }
+
+    table -> weights = NULL;
+    table -> threshold = NULL;
+    table -> alias = NULL;
+    table -> scaled = NULL;
+    table -> worklist = NULL;
+    table -> totalWeight = 0.0;
+    table -> size = 0;
+    table -> capacity = 0;
+}
+
+// Get the weights array of an alias table ready for a build over count indices
+double* prepareAliasTable(AliasTable* table, int count)
+{
+    // Validate input
+    if (table == NULL || count < 0)
+    {
+        fprintf(stderr, "Error: Tried preparing an invalid alias table.\n");
+        return NULL;
+    }
+
+    // Grow the arrays if needed (never shrink, tables get rebuilt over similar sizes)
+    if (count > table -> capacity)
+    {
+        double* weights = (double*)realloc(table -> weights, sizeof(double) * count);
+        if (weights != NULL) { table -> weights = weights; }
+        uint64_t* threshold = (uint64_t*)realloc(table -> threshold, sizeof(uint64_t) * count);
+        if (threshold != NULL) { table -> threshold = threshold; }
+        int* alias = (int*)realloc(table -> alias, sizeof(int) * count);
+        if (alias != NULL) { table -> alias = alias; }
+        double* scaled = (double*)realloc(table -> scaled, sizeof(double) * count);
+        if (scaled != NULL) { table -> scaled = scaled; }
+        int* worklist = (int*)realloc(table -> worklist, sizeof(int) * count);
+        if (worklist != NULL) { table -> worklist = worklist; }
+
+        if (weights == NULL || threshold == NULL || alias == NULL || scaled == NULL || worklist == NULL)
+        {
+            fprintf(stderr, "Error: Failed allocating memory for an alias table of %d.\n", count);
+            table -> size = 0;
+            table -> totalWeight = 0.0;
+            return NULL;
+        }
+
+        table -> capacity = count;
+    }
+
+    table -> size = count;
+    table -> totalWeight = 0.0;
+
+    return table -> weights;
+}
+
+// Build an alias table from the weights filled in after prepareAliasTable()
+void buildAliasTable(AliasTable* table)
+{
+    if (table == NULL) { return; }
+
+    int size = table -> size;
+
+    // Sum the weights, ignoring negative ones
+    double totalWeight = 0.0;
+    for (int i = 0; i < size; i++)
+    {
+        if (table -> weights[i] < 0.0) { table -> weights[i] = 0.0; }
+        totalWeight += table -> weights[i];
+    }
+
+    table -> totalWeight = totalWeight;
+    if (totalWeight <= 0.0) { return; }
+
+    // Scale the weights so they average 1, then sort the columns into those
+    // below average (front of the worklist) and those above it (back)
+    int numSmall = 0;
+    int numLarge = 0;
+    for (int i = 0; i < size; i++)
+    {
+        table -> scaled[i] = table -> weights[i] * size / totalWeight;
+        if (table -> scaled[i] < 1.0) {
+            table -> worklist[numSmall++] = i;
+        } else {
+            table -> worklist[size - 1 - numLarge++] = i;
+        }
+    }
+
+    // Fill every small column up to 1 with part of a large one
+    while (numSmall > 0 && numLarge > 0)
+    {
+        int small = table -> worklist[--numSmall];
+        int large = table -> worklist[size - numLarge];
+
+        table -> threshold[small] = randomThreshold(table -> scaled[small]);
+        table -> alias[small] = large;
+
+        // Whatever the large column has left decides which list it is on now
+        table -> scaled[large] = (table -> scaled[large] + table -> scaled[small]) - 1.0;
+        if (table -> scaled[large] < 1.0)
+        {
+            numLarge--;
+            table -> worklist[numSmall++] = large;
+        }
+    }
+
+    // Anything left is (up to rounding) exactly full, and always keeps its column
+    while (numLarge > 0)
+    {
+        int large = table -> worklist[size - numLarge--];
+        table -> threshold[large] = RANDOM_THRESHOLD(1.0);
+        table -> alias[large] = large;
+    }
+    while (numSmall > 0)
+    {
+        int small = table -> worklist[--numSmall];
+        table -> threshold[small] = RANDOM_THRESHOLD(1.0);
+        table -> alias[small] = small;
+    }
+}
+
+// Draw a random index from an alias table, with probability proportional to its weight
+int sampleAliasTable(const AliasTable* table, RandomState* rng)
+{
+    if (table == NULL || rng == NULL || table -> size <= 0 || table -> totalWeight <= 0.0)
+    {
+        return -1;
+    }
+
+    // Pick a column uniformly, then either keep it or take its alias
+    int column = randomStateInt(rng, 0, table -> size - 1);
+    if (randomBernoulli(rng, table -> threshold[column])) { return column; }
+
+    return table -> alias[column];
+}
+
+// Free all memory allocated for an alias table, leaving it empty
+void freeAliasTable(AliasTable* table)
+{
+    if (table == NULL) { return; }
+
+    free(table -> weights);
+    free(table -> threshold);
+    free(table -> alias);
+    free(table -> scaled);
+    free(table -> worklist);
+
+    initAliasTable(table);
+}
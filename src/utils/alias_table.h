@@ -0,0 +1,81 @@
+#ifndef ALIAS_TABLE_H
+#define ALIAS_TABLE_H
+
+/**
+ * @author Javier A. Rodillas
+ * @details Header file for the alias table utility module, used to draw
+ *          weighted random picks in constant time.
+ */
+
+
+
+/* INCLUDE STATEMENTS & DEFINITIONS */
+#include "random_utils.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+
+
+/* FUNCTION PROTOTYPES */
+
+/**
+ * AliasTable @struct holding a Walker alias table: every column keeps its own
+ * index with some probability and otherwise falls back to its alias, so a
+ * weighted pick is one bounded integer draw plus one Bernoulli trial. The
+ * arrays are reused between builds and only grow.
+ */
+typedef struct {
+    double* weights;        // Weight of each index, filled in by the caller before a build
+    uint64_t* threshold;    // Chance of keeping each column, as a randomBernoulli() threshold
+    int* alias;             // Index to return when a column isn't kept
+    double* scaled;         // Scratch space for building, weights scaled so they average 1
+    int* worklist;          // Scratch space for building, small & large columns
+    double totalWeight;     // Sum of the weights of the last build
+    int size;               // Number of indices the table was last built over
+    int capacity;           // Number of indices the arrays have room for
+} AliasTable;
+
+/**
+ * Initialize an empty alias table
+ *
+ * @param table that we want to initialize
+ */
+void initAliasTable(AliasTable* table);
+
+/**
+ * Get the weights array of an alias table ready for a build over count indices
+ *
+ * @param table that we are going to build
+ * @param count number of indices (weights) in the next build
+ *
+ * @return table's weights array with room for count weights (to be filled in by
+ *         the caller), NULL if it could not be allocated
+ */
+double* prepareAliasTable(AliasTable* table, int count);
+
+/**
+ * Build an alias table from the weights filled in after prepareAliasTable().
+ * Negative weights count as zero, indices with a weight of zero are never drawn.
+ *
+ * @param table that we are building
+ */
+void buildAliasTable(AliasTable* table);
+
+/**
+ * Draw a random index from an alias table, with probability proportional to its weight
+ *
+ * @param table that we are drawing from
+ * @param rng stream that we are drawing from
+ *
+ * @return index in the range [0, size), or -1 if every weight was zero
+ */
+int sampleAliasTable(const AliasTable* table, RandomState* rng);
+
+/**
+ * Free all memory allocated for an alias table, leaving it empty
+ *
+ * @param table that we want to free
+ */
+void freeAliasTable(AliasTable* table);
+
+#endif
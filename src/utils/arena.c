@@ -0,0 +1,108 @@
+/**
+ * @author  Javier A. Rodillas
+ * @details Class implementation of the arena allocator utility class.
+ */
+
+/* INCLUDE STATEMENTS */
+
+#include "arena.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+// Round a size up to the arena alignment
+#define ARENA_ALIGN_UP(size) (((size) + (ARENA_ALIGNMENT - 1)) & ~(size_t)(ARENA_ALIGNMENT - 1))
+
+// Data of a block starts right after its (aligned) header
+#define ARENA_HEADER_SIZE ARENA_ALIGN_UP(sizeof(ArenaBlock))
+
+
+
+/* FUNCTIONS */
+
+// Initialize an empty arena
+void initArena(Arena* arena, size_t blockSize)
+{
+    if (arena == NULL) { return; }
+
+    arena -> head = NULL;
+    arena -> current = NULL;
+    arena -> blockSize = (blockSize > 0) ? ARENA_ALIGN_UP(blockSize) : ARENA_DEFAULT_BLOCK_SIZE;
+}
+
+// Allocate memory from an arena
+void* arenaAlloc(Arena* arena, size_t size)
+{
+    if (arena == NULL)
+    {
+        fprintf(stderr, "Error: Tried allocating from a NULL arena.\n");
+        return NULL;
+    }
+
+    size = ARENA_ALIGN_UP(size);
+
+    // Move along the blocks kept from before the last rewind until one has room
+    ArenaBlock* previous = NULL;
+    ArenaBlock* block = arena -> current;
+    while (block != NULL && block -> used + size > block -> size)
+    {
+        previous = block;
+        block = block -> next;
+        if (block != NULL) { block -> used = 0; }
+    }
+
+    // Out of blocks, add a new one to the end of the list
+    if (block == NULL)
+    {
+        size_t blockSize = (size > arena -> blockSize) ? size : arena -> blockSize;
+        block = (ArenaBlock*)malloc(ARENA_HEADER_SIZE + blockSize);
+        if (block == NULL)
+        {
+            fprintf(stderr, "Error: Failed allocating an arena block of %zu bytes.\n", blockSize);
+            return NULL;
+        }
+
+        block -> next = NULL;
+        block -> size = blockSize;
+        block -> used = 0;
+
+        if (previous != NULL) {
+            previous -> next = block;
+        } else {
+            arena -> head = block;
+        }
+    }
+
+    // Bump allocate from the block
+    arena -> current = block;
+    void* memory = (unsigned char*)block + ARENA_HEADER_SIZE + block -> used;
+    block -> used += size;
+
+    return memory;
+}
+
+// Rewind an arena, releasing everything allocated from it at once
+void resetArena(Arena* arena)
+{
+    if (arena == NULL) { return; }
+
+    // Later blocks are rewound as allocations reach them again
+    arena -> current = arena -> head;
+    if (arena -> head != NULL) { arena -> head -> used = 0; }
+}
+
+// Free every block of an arena, leaving it empty
+void freeArena(Arena* arena)
+{
+    if (arena == NULL) { return; }
+
+    ArenaBlock* block = arena -> head;
+    while (block != NULL)
+    {
+        ArenaBlock* next = block -> next;
+        free(block);
+        block = next;
+    }
+
+    arena -> head = NULL;
+    arena -> current = NULL;
+}
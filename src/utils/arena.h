@@ -0,0 +1,76 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+/**
+ * @author Javier A. Rodillas
+ * @details Header file for the arena allocator utility module.
+ */
+
+
+
+/* INCLUDE STATEMENTS & DEFINITIONS */
+#include <stddef.h>
+
+#define ARENA_ALIGNMENT 16              // Every allocation starts on a multiple of this
+#define ARENA_DEFAULT_BLOCK_SIZE 65536  // Bytes per block unless a single allocation needs more
+
+
+
+/* FUNCTION PROTOTYPES */
+
+/**
+ * ArenaBlock @struct one contiguous chunk of memory that allocations are carved from
+ */
+typedef struct ArenaBlock {
+    struct ArenaBlock* next;    // Next block in the arena (NULL for the last one)
+    size_t size;                // Usable bytes in the block
+    size_t used;                // Bytes handed out since the block was last rewound
+} ArenaBlock;
+
+/**
+ * Arena @struct bump allocator that hands out memory from a list of blocks.
+ * Allocations are never freed one by one, the whole arena is rewound (or freed)
+ * at once, so everything with the same lifetime (i.e. a season's fixtures)
+ * costs a handful of mallocs in total and is released in O(1).
+ */
+typedef struct {
+    ArenaBlock* head;           // First block (NULL until the first allocation)
+    ArenaBlock* current;        // Block allocations are currently carved from
+    size_t blockSize;           // Size of new blocks
+} Arena;
+
+/**
+ * Initialize an empty arena
+ *
+ * @param arena that we want to initialize
+ * @param blockSize bytes per block (0 => ARENA_DEFAULT_BLOCK_SIZE)
+ */
+void initArena(Arena* arena, size_t blockSize);
+
+/**
+ * Allocate memory from an arena
+ *
+ * @param arena that we are allocating from
+ * @param size in bytes of the allocation
+ *
+ * @return pointer to ARENA_ALIGNMENT aligned (uninitialized) memory, NULL if
+ *         a new block could not be allocated
+ */
+void* arenaAlloc(Arena* arena, size_t size);
+
+/**
+ * Rewind an arena, releasing everything allocated from it at once while keeping
+ * its blocks for the next allocations. Pointers into the arena become invalid.
+ *
+ * @param arena that we want to rewind
+ */
+void resetArena(Arena* arena);
+
+/**
+ * Free every block of an arena, leaving it empty
+ *
+ * @param arena that we want to free
+ */
+void freeArena(Arena* arena);
+
+#endif
@@ -0,0 +1,255 @@
+/**
+ * @author  Javier A. Rodillas
+ * @details Class implementation of the name index utility class.
+ *
+ * @cite    FNV-1a hash:
+ *          http://www.isthe.com/chongo/tech/comp/fnv/
+ */
+
+/* INCLUDE STATEMENTS */
+
+#include "name_index.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define FNV_OFFSET_BASIS 14695981039346656037ULL
+#define FNV_PRIME 1099511628211ULL
+
+static NameIndex defaultNameIndex;
+static bool defaultNameIndexInitialized = false;
+
+
+
+/* HELPER FUNCTION PROTOTYPE(s) */
+static int findBucket(const NameIndex* index, const char* name, uint64_t hash);
+static bool growBuckets(NameIndex* index);
+
+
+
+/* FUNCTIONS */
+
+// Hash a name (FNV-1a, 64 bit)
+uint64_t hashName(const char* name)
+{
+    uint64_t hash = FNV_OFFSET_BASIS;
+    for (const unsigned char* c = (const unsigned char*)name; *c != '\0'; c++)
+    {
+        hash ^= *c;
+        hash *= FNV_PRIME;
+    }
+
+    return hash;
+}
+
+// Initialize an empty name index
+void initNameIndex(NameIndex* index)
+{
+    if (index == NULL) { return; }
+
+    index -> names = NULL;
+    index -> hashes = NULL;
+    index -> buckets = NULL;
+    index -> numNames = 0;
+    index -> nameCapacity = 0;
+    index -> numBuckets = 0;
+    initArena(&index -> strings, 0);
+}
+
+// Get the id of a name, interning it if the index hasn't seen it before
+int internName(NameIndex* index, const char* name)
+{
+    // Validate input
+    if (index == NULL || name == NULL)
+    {
+        fprintf(stderr, "Error: Cannot intern a NULL name or into a NULL index.\n");
+        return -1;
+    }
+
+    uint64_t hash = hashName(name);
+    if (index -> numBuckets > 0)
+    {
+        int bucket = findBucket(index, name, hash);
+        if (index -> buckets[bucket] != -1) { return index -> buckets[bucket]; }
+    }
+
+    // Keep the table at most half full
+    if (2 * (index -> numNames + 1) > index -> numBuckets && growBuckets(index) == false)
+    {
+        return -1;
+    }
+
+    // Grow the per-id arrays if needed
+    if (index -> numNames == index -> nameCapacity)
+    {
+        int capacity = (index -> nameCapacity > 0) ? 2 * index -> nameCapacity : NAME_INDEX_MIN_BUCKETS / 2;
+        const char** names = (const char**)realloc((void*)index -> names, capacity * sizeof(const char*));
+        if (names != NULL) { index -> names = names; }
+        uint64_t* hashes = (uint64_t*)realloc(index -> hashes, capacity * sizeof(uint64_t));
+        if (hashes != NULL) { index -> hashes = hashes; }
+
+        if (names == NULL || hashes == NULL)
+        {
+            fprintf(stderr, "Error: Failed to allocate memory for name index of %d names.\n", capacity);
+            return -1;
+        }
+
+        index -> nameCapacity = capacity;
+    }
+
+    // Copy the name into the index, so it outlives whoever passed it in
+    size_t length = strlen(name) + 1;
+    char* copy = (char*)arenaAlloc(&index -> strings, length);
+    if (copy == NULL) { return -1; }
+    memcpy(copy, name, length);
+
+    int id = index -> numNames++;
+    index -> names[id] = copy;
+    index -> hashes[id] = hash;
+    index -> buckets[findBucket(index, name, hash)] = id;
+
+    return id;
+}
+
+// Get the id of a name without interning it
+int findNameId(const NameIndex* index, const char* name)
+{
+    if (index == NULL || name == NULL || index -> numBuckets == 0) { return -1; }
+
+    return index -> buckets[findBucket(index, name, hashName(name))];
+}
+
+// Get the interned name of an id
+const char* getInternedName(const NameIndex* index, int id)
+{
+    if (index == NULL || id < 0 || id >= index -> numNames) { return NULL; }
+
+    return index -> names[id];
+}
+
+// Free all memory allocated for a name index, leaving it empty
+void freeNameIndex(NameIndex* index)
+{
+    if (index == NULL) { return; }
+
+    free((void*)index -> names);
+    free(index -> hashes);
+    free(index -> buckets);
+    freeArena(&index -> strings);
+
+    initNameIndex(index);
+}
+
+// Get the name index shared by every league & tournament
+NameIndex* getDefaultNameIndex()
+{
+    if (defaultNameIndexInitialized == false)
+    {
+        initNameIndex(&defaultNameIndex);
+        defaultNameIndexInitialized = true;
+    }
+
+    return &defaultNameIndex;
+}
+
+// Initialize an empty name to slot map
+void initNameSlotMap(NameSlotMap* map)
+{
+    if (map == NULL) { return; }
+
+    map -> slots = NULL;
+    map -> capacity = 0;
+}
+
+// Map an id to a slot, growing the map if needed
+bool setNameSlot(NameSlotMap* map, int id, int slot)
+{
+    if (map == NULL || id < 0) { return false; }
+
+    if (id >= map -> capacity)
+    {
+        // Unmapping an id the map never covered is a no-op
+        if (slot == -1) { return true; }
+
+        int capacity = (map -> capacity > 0) ? map -> capacity : NAME_INDEX_MIN_BUCKETS / 2;
+        while (capacity <= id) { capacity *= 2; }
+
+        int* slots = (int*)realloc(map -> slots, capacity * sizeof(int));
+        if (slots == NULL)
+        {
+            fprintf(stderr, "Error: Failed to allocate memory for name slot map of %d ids.\n", capacity);
+            return false;
+        }
+
+        for (int i = map -> capacity; i < capacity; i++) { slots[i] = -1; }
+        map -> slots = slots;
+        map -> capacity = capacity;
+    }
+
+    map -> slots[id] = slot;
+    return true;
+}
+
+// Get the slot an id maps to
+int getNameSlot(const NameSlotMap* map, int id)
+{
+    if (map == NULL || id < 0 || id >= map -> capacity) { return -1; }
+
+    return map -> slots[id];
+}
+
+// Free all memory allocated for a name to slot map, leaving it empty
+void freeNameSlotMap(NameSlotMap* map)
+{
+    if (map == NULL) { return; }
+
+    free(map -> slots);
+    initNameSlotMap(map);
+}
+
+
+
+/* HELPER FUNCTIONS */
+
+// Helper function to find the bucket holding a name, or the empty bucket it would go in
+static int findBucket(const NameIndex* index, const char* name, uint64_t hash)
+{
+    int mask = index -> numBuckets - 1;
+    int bucket = (int)(hash & (uint64_t)mask);
+
+    // Linear probing, only comparing strings when the full hashes match
+    while (index -> buckets[bucket] != -1)
+    {
+        int id = index -> buckets[bucket];
+        if (index -> hashes[id] == hash && strcmp(index -> names[id], name) == 0) { return bucket; }
+        bucket = (bucket + 1) & mask;
+    }
+
+    return bucket;
+}
+
+// Helper function to double the number of buckets & re-insert every id
+static bool growBuckets(NameIndex* index)
+{
+    int numBuckets = (index -> numBuckets > 0) ? 2 * index -> numBuckets : NAME_INDEX_MIN_BUCKETS;
+    int* buckets = (int*)malloc(numBuckets * sizeof(int));
+    if (buckets == NULL)
+    {
+        fprintf(stderr, "Error: Failed to allocate memory for name index of %d buckets.\n", numBuckets);
+        return false;
+    }
+
+    for (int i = 0; i < numBuckets; i++) { buckets[i] = -1; }
+    for (int id = 0; id < index -> numNames; id++)
+    {
+        int bucket = (int)(index -> hashes[id] & (uint64_t)(numBuckets - 1));
+        while (buckets[bucket] != -1) { bucket = (bucket + 1) & (numBuckets - 1); }
+        buckets[bucket] = id;
+    }
+
+    free(index -> buckets);
+    index -> buckets = buckets;
+    index -> numBuckets = numBuckets;
+
+    return true;
+}
@@ -0,0 +1,143 @@
+#ifndef NAME_INDEX_H
+#define NAME_INDEX_H
+
+/**
+ * @author Javier A. Rodillas
+ * @details Header file for the name index utility module.
+ */
+
+
+
+/* INCLUDE STATEMENTS & DEFINITIONS */
+#include "arena.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#define NAME_INDEX_MIN_BUCKETS 64       // Buckets of a name index before its first growth
+
+
+
+/* FUNCTION PROTOTYPES */
+
+/**
+ * NameIndex @struct hash index interning names into dense ids (0, 1, 2, ...).
+ * A name keeps its id for as long as the index lives, so one index can be
+ * shared by every league & tournament and a name resolved to an id once, then
+ * looked up anywhere in O(1) (see NameSlotMap).
+ */
+typedef struct {
+    const char** names;         // Interned copy of each id's name
+    uint64_t* hashes;           // Hash of each id's name
+    int* buckets;               // Open addressing table of ids (-1 => empty), power of two in size
+    int numNames;               // Number of names interned (next id)
+    int nameCapacity;           // Size of names & hashes
+    int numBuckets;             // Size of buckets (0 => not allocated)
+    Arena strings;              // Memory the interned names are copied into
+} NameIndex;
+
+/**
+ * NameSlotMap @struct maps the ids of a NameIndex to slots of one collection
+ * (i.e. a team's index in a league), -1 for ids that aren't in it
+ */
+typedef struct {
+    int* slots;                 // Slot of each id (-1 => not in the collection)
+    int capacity;               // Number of ids slots covers
+} NameSlotMap;
+
+/**
+ * Hash a name (FNV-1a, 64 bit), the same hash the name index uses
+ *
+ * @param name that we want to hash
+ *
+ * @return hash of the name
+ */
+uint64_t hashName(const char* name);
+
+/**
+ * Initialize an empty name index
+ *
+ * @param index that we want to initialize
+ */
+void initNameIndex(NameIndex* index);
+
+/**
+ * Get the id of a name, interning it if the index hasn't seen it before
+ *
+ * @param index that we are interning into
+ * @param name that we want the id of
+ *
+ * @return id of the name, -1 if it couldn't be interned
+ */
+int internName(NameIndex* index, const char* name);
+
+/**
+ * Get the id of a name without interning it
+ *
+ * @param index that we are searching
+ * @param name that we want the id of
+ *
+ * @return id of the name, -1 if it was never interned
+ */
+int findNameId(const NameIndex* index, const char* name);
+
+/**
+ * Get the interned name of an id
+ *
+ * @param index that the id is from
+ * @param id of the name
+ *
+ * @return the interned name, NULL for an unknown id
+ */
+const char* getInternedName(const NameIndex* index, int id);
+
+/**
+ * Free all memory allocated for a name index, leaving it empty
+ *
+ * @param index that we want to free
+ */
+void freeNameIndex(NameIndex* index);
+
+/**
+ * Get the name index shared by every league & tournament unless they are given
+ * their own one
+ *
+ * @return pointer to the default name index
+ */
+NameIndex* getDefaultNameIndex();
+
+/**
+ * Initialize an empty name to slot map
+ *
+ * @param map that we want to initialize
+ */
+void initNameSlotMap(NameSlotMap* map);
+
+/**
+ * Map an id to a slot (-1 to unmap it), growing the map if needed
+ *
+ * @param map that we are updating
+ * @param id of the name
+ * @param slot of the name in the collection (-1 => not in it)
+ *
+ * @return boolean indicating success or failure to map the id
+ */
+bool setNameSlot(NameSlotMap* map, int id, int slot);
+
+/**
+ * Get the slot an id maps to
+ *
+ * @param map that we are searching
+ * @param id of the name
+ *
+ * @return slot of the id, -1 if it isn't mapped
+ */
+int getNameSlot(const NameSlotMap* map, int id);
+
+/**
+ * Free all memory allocated for a name to slot map, leaving it empty
+ *
+ * @param map that we want to free
+ */
+void freeNameSlotMap(NameSlotMap* map);
+
+#endif
@@ -1,6 +1,11 @@
 /**
  * @author  Javier A. Rodillas
- * @details Class implementation of the random number generation utility class. 
+ * @details Class implementation of the random number generation utility class.
+ *
+ * @cite    xoshiro256++ and splitmix64 generators from:
+ *          https://prng.di.unimi.it/
+ * @cite    Unbiased bounded integers (Lemire's multiply & reject method):
+ *          https://arxiv.org/abs/1805.10941
  */
 
 /* INCLUDE STATEMENTS */
@@ -8,38 +13,343 @@
 #include "random_utils.h"
 #include <time.h>
 #include <stdlib.h>
+#include <math.h>
+
+// AVX2 lane generator is only available on x86 with GCC/Clang
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#include <immintrin.h>
+#define RANDOM_HAVE_AVX2 1
+#endif
+
+#define RANDOM_BULK_BLOCK 64    // 64 bit values generated per batch (multiple of RANDOM_LANES)
+
+
+
+/* HELPER FUNCTION PROTOTYPE(s) */
+static uint64_t splitMix64(uint64_t* x);
+static uint64_t rotateLeft(uint64_t x, int k);
+static void generateLanes(uint64_t lanes[4][RANDOM_LANES], uint64_t* out, int count);
+static void generateLanesScalar(uint64_t lanes[4][RANDOM_LANES], uint64_t* out, int count);
+#ifdef RANDOM_HAVE_AVX2
+static void generateLanesAvx2(uint64_t lanes[4][RANDOM_LANES], uint64_t* out, int count);
+#endif
 
 
 
 /* FUNCTIONS */
 
-//  Initialize random seed if not yet done
+// Seed a random stream
+void seedRandomState(RandomState* state, uint64_t seed)
+{
+    if (state == NULL) { return; }
+
+    // Expand the seed with splitmix64 so that similar seeds give unrelated streams
+    uint64_t x = seed;
+    for (int i = 0; i < 4; i++)
+    {
+        state -> s[i] = splitMix64(&x);
+    }
+}
+
+// Seed a new random stream from the output of an existing one
+void splitRandomState(RandomState* parent, RandomState* child)
+{
+    if (parent == NULL || child == NULL) { return; }
+
+    seedRandomState(child, randomNext(parent));
+}
+
+// Derive an independent random stream from a seed and a (stream, round, index) key
+void deriveRandomState(RandomState* state, uint64_t seed, uint32_t stream, uint32_t round, uint32_t index)
+{
+    if (state == NULL) { return; }
+
+    // Counter based derivation: each key component goes through a full
+    // splitmix64 round, so neighbouring keys give unrelated streams
+    uint64_t x = seed;
+    uint64_t key = splitMix64(&x);
+    key ^= ((uint64_t)stream << 32) | round;
+    x = key;
+    key = splitMix64(&x) ^ index;
+    x = key;
+
+    for (int i = 0; i < 4; i++)
+    {
+        state -> s[i] = splitMix64(&x);
+    }
+}
+
+// Generate the next raw 64 bit value of a random stream (xoshiro256++)
+uint64_t randomNext(RandomState* state)
+{
+    uint64_t* s = state -> s;
+    const uint64_t result = rotateLeft(s[0] + s[3], 23) + s[0];
+    const uint64_t t = s[1] << 17;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotateLeft(s[3], 45);
+
+    return result;
+}
+
+// Generate a random double in the range [0, 1) from a random stream
+double randomStateProbability(RandomState* state)
+{
+    // Top 53 bits => every double is exactly representable
+    return (double)(randomNext(state) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+// Generate an unbiased random number (int) in the range (min, max) inclusive from a random stream
+int randomStateInt(RandomState* state, int min, int max)
+{
+    uint64_t range = (uint64_t)((int64_t)max - (int64_t)min) + 1;
+    uint32_t x = (uint32_t)(randomNext(state) >> 32);
+
+    // Whole 32 bit range, every draw is already uniform
+    if (range > UINT32_MAX) { return (int)((int64_t)min + x); }
+
+    // Scale the draw into the range with a multiply, rejecting the few low
+    // products that would over-represent some values (rarely more than one draw)
+    uint64_t product = (uint64_t)x * range;
+    uint32_t low = (uint32_t)product;
+    if (low < range)
+    {
+        uint32_t rejectBelow = (uint32_t)((UINT32_MAX - range + 1) % range);
+        while (low < rejectBelow)
+        {
+            x = (uint32_t)(randomNext(state) >> 32);
+            product = (uint64_t)x * range;
+            low = (uint32_t)product;
+        }
+    }
+
+    return (int)((int64_t)min + (int64_t)(product >> 32));
+}
+
+// Convert a probability into an integer threshold for raw 32 bit draws
+uint64_t randomThreshold(double probability)
+{
+    if (probability <= 0.0) { return 0; }
+    if (probability >= 1.0) { return (uint64_t)1 << 32; }
+
+    return (uint64_t)(probability * RANDOM_THRESHOLD_SCALE);
+}
+
+// Run a Bernoulli trial against a precomputed threshold
+bool randomBernoulli(RandomState* state, uint64_t threshold)
+{
+    return (randomNext(state) >> 32) < threshold;
+}
+
+// Sample the number of successes in n trials of probability p (binomial distribution)
+int randomBinomial(RandomState* state, int n, double p)
+{
+    if (n <= 0 || p <= 0.0) { return 0; }
+    if (p >= 1.0) { return n; }
+
+    // Walk up the CDF until it passes a single uniform draw
+    double u = randomStateProbability(state);
+    double ratio = p / (1.0 - p);
+    double probability = pow(1.0 - p, n);   // P(X = 0)
+    double cumulative = probability;
+    int k = 0;
+
+    while (u >= cumulative && k < n)
+    {
+        probability *= ratio * (double)(n - k) / (double)(k + 1);
+        cumulative += probability;
+        k++;
+    }
+
+    return k;
+}
+
+// Seed the lanes of the bulk generator, each from its own draw of a stream
+void seedRandomLanes(RandomLanes* lanes, RandomState* state)
+{
+    if (lanes == NULL || state == NULL) { return; }
+
+    for (int lane = 0; lane < RANDOM_LANES; lane++)
+    {
+        RandomState laneState;
+        seedRandomState(&laneState, randomNext(state));
+
+        for (int word = 0; word < 4; word++)
+        {
+            lanes -> s[word][lane] = laneState.s[word];
+        }
+    }
+}
+
+// Fill a buffer with random 32 bit values drawn from seeded lanes
+void randomFillUint32(RandomLanes* lanes, uint32_t* out, int count)
+{
+    if (lanes == NULL || out == NULL || count <= 0) { return; }
+
+    uint64_t block[RANDOM_BULK_BLOCK];
+
+    // Every 64 bit value gives two 32 bit values (low half first)
+    int filled = 0;
+    while (filled < count)
+    {
+        int needed = (count - filled + 1) / 2;
+        int generated = (needed + RANDOM_LANES - 1) / RANDOM_LANES * RANDOM_LANES;
+        if (generated > RANDOM_BULK_BLOCK) { generated = RANDOM_BULK_BLOCK; }
+
+        generateLanes(lanes -> s, block, generated);
+        for (int i = 0; i < generated && filled < count; i++)
+        {
+            out[filled++] = (uint32_t)block[i];
+            if (filled < count) { out[filled++] = (uint32_t)(block[i] >> 32); }
+        }
+    }
+}
+
+// Fill a buffer with random doubles in the range [0, 1) drawn from seeded lanes
+void randomFillProbabilities(RandomLanes* lanes, double* out, int count)
+{
+    if (lanes == NULL || out == NULL || count <= 0) { return; }
+
+    uint64_t block[RANDOM_BULK_BLOCK];
+
+    int filled = 0;
+    while (filled < count)
+    {
+        int generated = (count - filled + RANDOM_LANES - 1) / RANDOM_LANES * RANDOM_LANES;
+        if (generated > RANDOM_BULK_BLOCK) { generated = RANDOM_BULK_BLOCK; }
+
+        generateLanes(lanes -> s, block, generated);
+        for (int i = 0; i < generated && filled < count; i++)
+        {
+            out[filled++] = (double)(block[i] >> 11) * (1.0 / 9007199254740992.0);
+        }
+    }
+}
+
+//  Get the process wide default random stream (seeded on first use)
 static bool randomInitialized = false;
+static RandomState defaultRandomState;
+RandomState* getDefaultRandomState()
+{
+    initRandom();
+    return &defaultRandomState;
+}
+
+//  Initialize random seed if not yet done
 void initRandom()
 {
     if (randomInitialized == false)
     {
-        srand((unsigned int)time(NULL));
+        seedRandomState(&defaultRandomState, (uint64_t)time(NULL));
         randomInitialized = true;
     }
 }
 
+// Seed the default stream explicitly so that a run can be reproduced
+void seedRandom(uint64_t seed)
+{
+    seedRandomState(&defaultRandomState, seed);
+    randomInitialized = true;
+}
+
 // Generate a random number (double) between 0 and 1
 double randomProbability()
 {
-    // Ensure random seed is initialized
-    initRandom();
-
-    // Generate a number b/w (0 & RAND_MAX) and div by RAND_MAX ~> Number b/w (0 & 1)
-    return (double)rand() / RAND_MAX;
+    return randomStateProbability(getDefaultRandomState());
 }
 
 // Generate a random number (int) in the range (min, max) inclusive
 int randomInt(int min, int max)
 {
-    // Ensure random seed is initialized
-    initRandom();
+    return randomStateInt(getDefaultRandomState(), min, max);
+}
+
+
+
+/* HELPER FUNCTIONS */
+
+// splitmix64 step, used to expand seeds into full generator states
+static uint64_t splitMix64(uint64_t* x)
+{
+    uint64_t z = (*x += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// Rotate a 64 bit value left by k bits
+static uint64_t rotateLeft(uint64_t x, int k)
+{
+    return (x << k) | (x >> (64 - k));
+}
+
+// Generate count (multiple of RANDOM_LANES) values, output i comes from lane i % RANDOM_LANES
+static void generateLanes(uint64_t lanes[4][RANDOM_LANES], uint64_t* out, int count)
+{
+#ifdef RANDOM_HAVE_AVX2
+    if (__builtin_cpu_supports("avx2"))
+    {
+        generateLanesAvx2(lanes, out, count);
+        return;
+    }
+#endif
+    generateLanesScalar(lanes, out, count);
+}
+
+// Portable lane generator, produces exactly the same values as the AVX2 one
+static void generateLanesScalar(uint64_t lanes[4][RANDOM_LANES], uint64_t* out, int count)
+{
+    for (int i = 0; i < count; i += RANDOM_LANES)
+    {
+        for (int lane = 0; lane < RANDOM_LANES; lane++)
+        {
+            RandomState laneState = {{ lanes[0][lane], lanes[1][lane], lanes[2][lane], lanes[3][lane] }};
+            out[i + lane] = randomNext(&laneState);
+
+            for (int word = 0; word < 4; word++)
+            {
+                lanes[word][lane] = laneState.s[word];
+            }
+        }
+    }
+}
+
+#ifdef RANDOM_HAVE_AVX2
+// Rotate each 64 bit element of a vector left by k bits
+#define ROTATE_LEFT_256(x, k) _mm256_or_si256(_mm256_slli_epi64((x), (k)), _mm256_srli_epi64((x), 64 - (k)))
+
+// AVX2 lane generator, steps all four xoshiro256++ lanes with one instruction each
+__attribute__((target("avx2")))
+static void generateLanesAvx2(uint64_t lanes[4][RANDOM_LANES], uint64_t* out, int count)
+{
+    __m256i s0 = _mm256_loadu_si256((const __m256i*)lanes[0]);
+    __m256i s1 = _mm256_loadu_si256((const __m256i*)lanes[1]);
+    __m256i s2 = _mm256_loadu_si256((const __m256i*)lanes[2]);
+    __m256i s3 = _mm256_loadu_si256((const __m256i*)lanes[3]);
+
+    for (int i = 0; i < count; i += RANDOM_LANES)
+    {
+        __m256i sum = _mm256_add_epi64(s0, s3);
+        __m256i result = _mm256_add_epi64(ROTATE_LEFT_256(sum, 23), s0);
+        __m256i t = _mm256_slli_epi64(s1, 17);
+
+        s2 = _mm256_xor_si256(s2, s0);
+        s3 = _mm256_xor_si256(s3, s1);
+        s1 = _mm256_xor_si256(s1, s2);
+        s0 = _mm256_xor_si256(s0, s3);
+        s2 = _mm256_xor_si256(s2, t);
+        s3 = ROTATE_LEFT_256(s3, 45);
+
+        _mm256_storeu_si256((__m256i*)(out + i), result);
+    }
 
-    // Generate a number between min and max (inclusive)
-    return (rand() % (max - min + 1)) + min;
+    _mm256_storeu_si256((__m256i*)lanes[0], s0);
+    _mm256_storeu_si256((__m256i*)lanes[1], s1);
+    _mm256_storeu_si256((__m256i*)lanes[2], s2);
+    _mm256_storeu_si256((__m256i*)lanes[3], s3);
 }
+#endif
@@ -3,38 +3,199 @@
 
 /**
  * @author Javier A. Rodillas
- * @details Header file for the random number generation utility module. 
+ * @details Header file for the random number generation utility module.
  */
 
 
 
-/* INCLUDE STATEMENTS */
+/* INCLUDE STATEMENTS & DEFINITIONS */
 #include <stdbool.h>
+#include <stdint.h>
+
+#define RANDOM_THRESHOLD_SCALE 4294967296.0     // 2^32, one past the largest 32 bit draw
+#define RANDOM_LANES 4                          // Independent generators run side by side by the bulk fills
+
+// Integer threshold for a compile time probability (see randomThreshold())
+#define RANDOM_THRESHOLD(probability) ((uint64_t)((probability) * RANDOM_THRESHOLD_SCALE))
 
 
 
 /* FUNCTION PROTOTYPES */
 
 /**
- * Initialize random seed if not yet done
+ * RandomState @struct holding one independent xoshiro256++ random stream.
+ * Every simulation (or worker thread) should own its own stream so that no
+ * hidden global state is shared between them.
+ */
+typedef struct {
+    uint64_t s[4];      // Generator state (never all zeros once seeded)
+} RandomState;
+
+/**
+ * RandomLanes @struct four xoshiro256++ lanes run side by side by the bulk
+ * fills. Seeding them takes a draw & a full seeding per lane, so they are
+ * seeded once (i.e. per match) & kept for every fill after that.
+ */
+typedef struct {
+    uint64_t s[4][RANDOM_LANES];    // State of each lane, stored [word][lane] so each word loads as one vector
+} RandomLanes;
+
+/**
+ * Seed a random stream
+ *
+ * @param state that we want to seed
+ * @param seed value used to initialize the stream
+ */
+void seedRandomState(RandomState* state, uint64_t seed);
+
+/**
+ * Seed a new random stream from the output of an existing one
+ *
+ * @param parent stream that we are drawing the seed from
+ * @param child stream that we want to seed
+ */
+void splitRandomState(RandomState* parent, RandomState* child);
+
+/**
+ * Derive an independent random stream from a seed and a (stream, round, index)
+ * key. The same key always yields the same stream, so a match draws the same
+ * numbers no matter which thread simulates it or in what order.
+ *
+ * @param state stream that we want to seed
+ * @param seed of the whole simulation run
+ * @param stream identifier of the competition (i.e. league index)
+ * @param round within the competition (i.e. matchday)
+ * @param index within the round (i.e. match index)
+ */
+void deriveRandomState(RandomState* state, uint64_t seed, uint32_t stream, uint32_t round, uint32_t index);
+
+/**
+ * Generate the next raw 64 bit value of a random stream
+ *
+ * @param state stream that we are drawing from
+ *
+ * @return a uniformly distributed 64 bit value
+ */
+uint64_t randomNext(RandomState* state);
+
+/**
+ * Generate a random double from a random stream
+ *
+ * @param state stream that we are drawing from
+ *
+ * @return a double in the range of [0.0, 1.0)
+ */
+double randomStateProbability(RandomState* state);
+
+/**
+ * Generate an unbiased random integer from a random stream
+ *
+ * @param state stream that we are drawing from
+ * @param min lower bound for our random number
+ * @param max upper bound for our random number
+ *
+ * @return an int within the range of (min, max) inclusive
+ */
+int randomStateInt(RandomState* state, int min, int max);
+
+/**
+ * Convert a probability into an integer threshold, so that a Bernoulli trial
+ * becomes a single compare of a raw 32 bit draw with no division or int to
+ * double conversion: (draw < threshold) happens with the given probability.
+ *
+ * @param probability of the event, clamped to [0.0, 1.0]
+ *
+ * @return threshold in the range [0, 2^32]
+ */
+uint64_t randomThreshold(double probability);
+
+/**
+ * Run a Bernoulli trial against a precomputed threshold
+ *
+ * @param state stream that we are drawing from
+ * @param threshold from randomThreshold()
+ *
+ * @return true with the probability the threshold was built from
+ */
+bool randomBernoulli(RandomState* state, uint64_t threshold);
+
+/**
+ * Sample the number of successes in n independent trials of probability p
+ * (binomial distribution) by inverting its CDF, which takes O(n * p) steps
+ *
+ * @param state stream that we are drawing from
+ * @param n number of trials
+ * @param p probability of success of each trial
+ *
+ * @return number of successes in the range [0, n]
+ */
+int randomBinomial(RandomState* state, int n, double p);
+
+/**
+ * Seed the lanes of the bulk generator, each from its own draw of a stream
+ *
+ * @param lanes that we want to seed
+ * @param state stream that we are drawing the seeds from
+ */
+void seedRandomLanes(RandomLanes* lanes, RandomState* state);
+
+/**
+ * Fill a buffer with random 32 bit values drawn from seeded lanes. The lanes
+ * run side by side (with AVX2 when the CPU supports it, otherwise in scalar
+ * code that produces the exact same values) & carry on where the last fill
+ * left them.
+ *
+ * @param lanes that we are drawing from (see seedRandomLanes())
+ * @param out buffer that we are filling
+ * @param count number of values to write to the buffer
+ */
+void randomFillUint32(RandomLanes* lanes, uint32_t* out, int count);
+
+/**
+ * Fill a buffer with random doubles drawn from seeded lanes, generated the
+ * same way as randomFillUint32()
+ *
+ * @param lanes that we are drawing from (see seedRandomLanes())
+ * @param out buffer that we are filling
+ * @param count number of values to write to the buffer
+ */
+void randomFillProbabilities(RandomLanes* lanes, double* out, int count);
+
+/**
+ * Get the process wide default random stream (seeded on first use).
+ * @attention NOT thread safe, simulations should use their own streams
+ *
+ * @return pointer to the default random stream
+ */
+RandomState* getDefaultRandomState();
+
+/**
+ * Initialize random seed (from the current time) if not yet done
  */
 void initRandom();
 
 /**
- * Generate a random double
- * 
- * @return a double in the range of 0.0 and 1.0
+ * Seed the default stream explicitly so that a run can be reproduced
+ *
+ * @param seed value used to initialize the default stream
+ */
+void seedRandom(uint64_t seed);
+
+/**
+ * Generate a random double from the default stream
+ *
+ * @return a double in the range of [0.0, 1.0)
  */
 double randomProbability();
 
 /**
- * Generate a random integer
- * 
+ * Generate a random integer from the default stream
+ *
  * @param min lower bound for our random number
  * @param max upper bound for our random number
- * 
+ *
  * @return an int within the range of (min, max) inclusive
  */
 int randomInt(int min, int max);
 
-#endif
\ No newline at end of file
+#endif
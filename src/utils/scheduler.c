@@ -0,0 +1,396 @@
+/**
+ * @author  Javier A. Rodillas
+ * @details Class implementation of the work-stealing scheduler utility class.
+ *
+ * @cite    Blumofe & Leiserson, "Scheduling Multithreaded Computations by
+ *          Work Stealing", Journal of the ACM 46(5), 1999
+ */
+
+/* INCLUDE STATEMENTS */
+
+#define _POSIX_C_SOURCE 200809L     // sysconf() & pthreads under -std=c99
+
+#include "scheduler.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+// Worker running on the current thread (NULL on threads that aren't workers)
+static pthread_key_t currentWorkerKey;
+static pthread_once_t currentWorkerKeyOnce = PTHREAD_ONCE_INIT;
+
+
+
+/* HELPER FUNCTION PROTOTYPE(s) */
+static void createCurrentWorkerKey(void);
+static int getOwnDeque(const Scheduler* scheduler);
+static void* runWorker(void* argument);
+static bool findTask(Scheduler* scheduler, int ownDeque, RandomState* rng, ScheduledTask* task);
+static void runTask(Scheduler* scheduler, const ScheduledTask* task);
+static void wakeSleepers(Scheduler* scheduler, bool everyone);
+static bool pushBottom(TaskDeque* deque, const ScheduledTask* task);
+static bool popBottom(TaskDeque* deque, ScheduledTask* task);
+static bool stealTop(TaskDeque* deque, ScheduledTask* task);
+
+
+
+/* FUNCTIONS */
+
+// Create a work-stealing scheduler
+Scheduler* createScheduler(int numThreads)
+{
+    // Default to one thread per online CPU
+    if (numThreads <= 0)
+    {
+        long numCpus = sysconf(_SC_NPROCESSORS_ONLN);
+        numThreads = (numCpus > 0) ? (int)numCpus : 1;
+    }
+
+    pthread_once(&currentWorkerKeyOnce, createCurrentWorkerKey);
+
+    // Allocate memory for the scheduler & NULL check
+    Scheduler* scheduler = (Scheduler*)malloc(sizeof(Scheduler));
+    if (scheduler == NULL)
+    {
+        fprintf(stderr, "Error: Failed to allocate memory for a scheduler.\n");
+        return NULL;
+    }
+
+    // One deque per thread, the outside threads share the first one
+    scheduler -> deques = (TaskDeque*)calloc(numThreads, sizeof(TaskDeque));
+    scheduler -> workers = (SchedulerWorker*)calloc(numThreads, sizeof(SchedulerWorker));
+    if (scheduler -> deques == NULL || scheduler -> workers == NULL)
+    {
+        fprintf(stderr, "Error: Failed to allocate memory for %d scheduler threads.\n", numThreads);
+        free(scheduler -> deques);
+        free(scheduler -> workers);
+        free(scheduler);
+        return NULL;
+    }
+
+    for (int i = 0; i < numThreads; i++) { pthread_mutex_init(&scheduler -> deques[i].lock, NULL); }
+    scheduler -> numDeques = numThreads;
+    pthread_mutex_init(&scheduler -> lock, NULL);
+    pthread_cond_init(&scheduler -> changed, NULL);
+    scheduler -> numQueued = 0;
+    scheduler -> numSleeping = 0;
+    scheduler -> shuttingDown = false;
+    scheduler -> numThreads = 1;
+
+    // Start the workers, keeping whichever ones could be started (they wait
+    // for the lock, so they only look at numThreads once it's final)
+    pthread_mutex_lock(&scheduler -> lock);
+    for (int i = 1; i < numThreads; i++)
+    {
+        SchedulerWorker* worker = &scheduler -> workers[i - 1];
+        worker -> scheduler = scheduler;
+        worker -> index = i;
+        seedRandomState(&worker -> rng, (uint64_t)i);
+
+        if (pthread_create(&worker -> thread, NULL, runWorker, worker) != 0)
+        {
+            fprintf(stderr, "Error: Failed to start worker thread %d, running with %d.\n",
+                    i, scheduler -> numThreads);
+            break;
+        }
+        scheduler -> numThreads++;
+    }
+    pthread_mutex_unlock(&scheduler -> lock);
+
+    return scheduler;
+}
+
+// Stop the workers of a scheduler & free it
+void destroyScheduler(Scheduler* scheduler)
+{
+    if (scheduler == NULL) { return; }
+
+    // Wake every worker up to see the scheduler shutting down
+    pthread_mutex_lock(&scheduler -> lock);
+    scheduler -> shuttingDown = true;
+    pthread_cond_broadcast(&scheduler -> changed);
+    pthread_mutex_unlock(&scheduler -> lock);
+
+    for (int i = 0; i < scheduler -> numThreads - 1; i++)
+    {
+        pthread_join(scheduler -> workers[i].thread, NULL);
+    }
+
+    // Workers that failed to start leave their deques behind, free all of them
+    for (int i = 0; i < scheduler -> numDeques; i++)
+    {
+        pthread_mutex_destroy(&scheduler -> deques[i].lock);
+        free(scheduler -> deques[i].tasks);
+    }
+    pthread_mutex_destroy(&scheduler -> lock);
+    pthread_cond_destroy(&scheduler -> changed);
+    free(scheduler -> deques);
+    free(scheduler -> workers);
+    free(scheduler);
+}
+
+// Initialize an empty task group
+void initTaskGroup(TaskGroup* group)
+{
+    if (group == NULL) { return; }
+
+    group -> pending = 0;
+}
+
+// Spawn a task into a group
+void spawnTask(Scheduler* scheduler, TaskGroup* group, SchedulerTask task, void* context, int index)
+{
+    // Validate input
+    if (group == NULL || task == NULL)
+    {
+        fprintf(stderr, "Error: Cannot spawn a NULL task or into a NULL group.\n");
+        return;
+    }
+
+    // Nobody to hand it to, just run it
+    if (scheduler == NULL || scheduler -> numThreads == 1)
+    {
+        task(context, index);
+        return;
+    }
+
+    ScheduledTask scheduled = { task, context, index, group };
+
+    // Count the task before it can be stolen, so it can't finish before it's counted
+    __atomic_add_fetch(&group -> pending, 1, __ATOMIC_SEQ_CST);
+    __atomic_add_fetch(&scheduler -> numQueued, 1, __ATOMIC_SEQ_CST);
+
+    if (pushBottom(&scheduler -> deques[getOwnDeque(scheduler)], &scheduled) == false)
+    {
+        // No room to queue it, run it here instead
+        __atomic_sub_fetch(&scheduler -> numQueued, 1, __ATOMIC_SEQ_CST);
+        runTask(scheduler, &scheduled);
+        return;
+    }
+
+    // One task, one thread to wake up for it
+    wakeSleepers(scheduler, false);
+}
+
+// Wait for every task of a group, running queued tasks in the meantime
+void waitTaskGroup(Scheduler* scheduler, TaskGroup* group)
+{
+    if (scheduler == NULL || group == NULL || scheduler -> numThreads == 1) { return; }
+
+    // Workers steal with their own stream, outside threads with one of their own
+    int ownDeque = getOwnDeque(scheduler);
+    RandomState outsideRng;
+    RandomState* rng = &outsideRng;
+    if (ownDeque > 0) { rng = &scheduler -> workers[ownDeque - 1].rng; }
+    else { seedRandomState(&outsideRng, (uint64_t)(size_t)group); }
+
+    while (__atomic_load_n(&group -> pending, __ATOMIC_SEQ_CST) > 0)
+    {
+        // Help with whatever is queued (our own tasks first), or sleep until something changes
+        ScheduledTask task;
+        if (findTask(scheduler, ownDeque, rng, &task) == true)
+        {
+            runTask(scheduler, &task);
+            continue;
+        }
+
+        pthread_mutex_lock(&scheduler -> lock);
+        __atomic_add_fetch(&scheduler -> numSleeping, 1, __ATOMIC_SEQ_CST);
+        while (__atomic_load_n(&group -> pending, __ATOMIC_SEQ_CST) > 0
+               && __atomic_load_n(&scheduler -> numQueued, __ATOMIC_SEQ_CST) == 0)
+        {
+            pthread_cond_wait(&scheduler -> changed, &scheduler -> lock);
+        }
+        __atomic_sub_fetch(&scheduler -> numSleeping, 1, __ATOMIC_SEQ_CST);
+        pthread_mutex_unlock(&scheduler -> lock);
+    }
+}
+
+// Run a task once for each index & wait for all of them
+void runScheduler(Scheduler* scheduler, SchedulerTask task, void* context, int numTasks)
+{
+    if (task == NULL || numTasks <= 0) { return; }
+
+    TaskGroup group;
+    initTaskGroup(&group);
+    for (int i = 0; i < numTasks; i++)
+    {
+        spawnTask(scheduler, &group, task, context, i);
+    }
+    waitTaskGroup(scheduler, &group);
+}
+
+// Get the number of threads that run a scheduler's tasks
+int getSchedulerSize(const Scheduler* scheduler)
+{
+    return (scheduler != NULL) ? scheduler -> numThreads : 1;
+}
+
+
+
+/* HELPER FUNCTIONS */
+
+// Helper function to create the key the current worker is stored under
+static void createCurrentWorkerKey(void)
+{
+    pthread_key_create(&currentWorkerKey, NULL);
+}
+
+// Helper function to get the deque of the current thread (0 unless it's one of the scheduler's workers)
+static int getOwnDeque(const Scheduler* scheduler)
+{
+    const SchedulerWorker* worker = (const SchedulerWorker*)pthread_getspecific(currentWorkerKey);
+
+    return (worker != NULL && worker -> scheduler == scheduler) ? worker -> index : 0;
+}
+
+// Helper function run by each worker thread: run tasks until the scheduler shuts down
+static void* runWorker(void* argument)
+{
+    SchedulerWorker* worker = (SchedulerWorker*)argument;
+    Scheduler* scheduler = worker -> scheduler;
+    pthread_setspecific(currentWorkerKey, worker);
+
+    // Wait until every worker has been started
+    pthread_mutex_lock(&scheduler -> lock);
+    pthread_mutex_unlock(&scheduler -> lock);
+
+    while (true)
+    {
+        ScheduledTask task;
+        if (findTask(scheduler, worker -> index, &worker -> rng, &task) == true)
+        {
+            runTask(scheduler, &task);
+            continue;
+        }
+
+        // Sleep until a task is queued (or a steal lost a race, then just retry)
+        pthread_mutex_lock(&scheduler -> lock);
+        __atomic_add_fetch(&scheduler -> numSleeping, 1, __ATOMIC_SEQ_CST);
+        while (__atomic_load_n(&scheduler -> numQueued, __ATOMIC_SEQ_CST) == 0 && scheduler -> shuttingDown == false)
+        {
+            pthread_cond_wait(&scheduler -> changed, &scheduler -> lock);
+        }
+        __atomic_sub_fetch(&scheduler -> numSleeping, 1, __ATOMIC_SEQ_CST);
+        bool finished = (__atomic_load_n(&scheduler -> numQueued, __ATOMIC_SEQ_CST) == 0 && scheduler -> shuttingDown == true);
+        pthread_mutex_unlock(&scheduler -> lock);
+
+        if (finished == true) { break; }
+    }
+
+    return NULL;
+}
+
+// Helper function to take a task from our own deque, else steal one from a random victim
+static bool findTask(Scheduler* scheduler, int ownDeque, RandomState* rng, ScheduledTask* task)
+{
+    bool found = popBottom(&scheduler -> deques[ownDeque], task);
+
+    // Start at a random victim so thieves spread out, then try every other deque
+    int numDeques = scheduler -> numThreads;
+    int victim = randomStateInt(rng, 0, numDeques - 1);
+    for (int i = 0; i < numDeques && found == false; i++)
+    {
+        int deque = (victim + i) % numDeques;
+        if (deque != ownDeque) { found = stealTop(&scheduler -> deques[deque], task); }
+    }
+
+    if (found == true) { __atomic_sub_fetch(&scheduler -> numQueued, 1, __ATOMIC_SEQ_CST); }
+
+    return found;
+}
+
+// Helper function to run a task & mark it finished in its group
+static void runTask(Scheduler* scheduler, const ScheduledTask* task)
+{
+    task -> function(task -> context, task -> index);
+
+    // Whoever waits for the group may be asleep among the workers, wake them all
+    if (__atomic_sub_fetch(&task -> group -> pending, 1, __ATOMIC_SEQ_CST) == 0)
+    {
+        wakeSleepers(scheduler, true);
+    }
+}
+
+// Helper function to wake one (or every) thread asleep on the scheduler. The
+// change was made before this is called & sleepers raise numSleeping before
+// checking for it, so either they see the change or we see them (no lost wakeups)
+static void wakeSleepers(Scheduler* scheduler, bool everyone)
+{
+    if (__atomic_load_n(&scheduler -> numSleeping, __ATOMIC_SEQ_CST) == 0) { return; }
+
+    pthread_mutex_lock(&scheduler -> lock);
+    if (everyone == true) {
+        pthread_cond_broadcast(&scheduler -> changed);
+    } else {
+        pthread_cond_signal(&scheduler -> changed);
+    }
+    pthread_mutex_unlock(&scheduler -> lock);
+}
+
+// Helper function to push a task onto the bottom of a deque, growing it if needed
+static bool pushBottom(TaskDeque* deque, const ScheduledTask* task)
+{
+    pthread_mutex_lock(&deque -> lock);
+
+    if (deque -> count == deque -> capacity)
+    {
+        int capacity = (deque -> capacity > 0) ? 2 * deque -> capacity : SCHEDULER_MIN_DEQUE_CAPACITY;
+        ScheduledTask* tasks = (ScheduledTask*)malloc(capacity * sizeof(ScheduledTask));
+        if (tasks == NULL)
+        {
+            pthread_mutex_unlock(&deque -> lock);
+            fprintf(stderr, "Error: Failed to allocate memory for a deque of %d tasks.\n", capacity);
+            return false;
+        }
+
+        // Unwrap the circular buffer into the start of the new one
+        for (int i = 0; i < deque -> count; i++)
+        {
+            tasks[i] = deque -> tasks[(deque -> top + i) % deque -> capacity];
+        }
+        free(deque -> tasks);
+        deque -> tasks = tasks;
+        deque -> capacity = capacity;
+        deque -> top = 0;
+    }
+
+    deque -> tasks[(deque -> top + deque -> count) % deque -> capacity] = *task;
+    deque -> count++;
+
+    pthread_mutex_unlock(&deque -> lock);
+    return true;
+}
+
+// Helper function to pop the newest task off the bottom of a deque
+static bool popBottom(TaskDeque* deque, ScheduledTask* task)
+{
+    pthread_mutex_lock(&deque -> lock);
+
+    bool found = (deque -> count > 0);
+    if (found == true)
+    {
+        deque -> count--;
+        *task = deque -> tasks[(deque -> top + deque -> count) % deque -> capacity];
+    }
+
+    pthread_mutex_unlock(&deque -> lock);
+    return found;
+}
+
+// Helper function to steal the oldest task off the top of a deque
+static bool stealTop(TaskDeque* deque, ScheduledTask* task)
+{
+    pthread_mutex_lock(&deque -> lock);
+
+    bool found = (deque -> count > 0);
+    if (found == true)
+    {
+        *task = deque -> tasks[deque -> top];
+        deque -> top = (deque -> top + 1) % deque -> capacity;
+        deque -> count--;
+    }
+
+    pthread_mutex_unlock(&deque -> lock);
+    return found;
+}
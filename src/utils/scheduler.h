@@ -0,0 +1,156 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+/**
+ * @author Javier A. Rodillas
+ * @details Header file for the work-stealing scheduler utility module.
+ */
+
+
+
+/* INCLUDE STATEMENTS & DEFINITIONS */
+#include "random_utils.h"
+#include <pthread.h>
+#include <stdbool.h>
+
+#define SCHEDULER_MIN_DEQUE_CAPACITY 64     // Tasks a deque holds before its first growth
+
+
+
+/* FUNCTION PROTOTYPES */
+
+/**
+ * SchedulerTask @typedef a task, called with the context & index it was
+ * spawned with. Tasks may spawn & wait for tasks of their own.
+ */
+typedef void (*SchedulerTask)(void* context, int index);
+
+/**
+ * TaskGroup @struct tasks that are waited for together (fork/join). A group
+ * lives on the stack of whoever spawns into it & waits for it.
+ */
+typedef struct {
+    int pending;                    // Tasks of the group that haven't finished (updated atomically)
+} TaskGroup;
+
+/**
+ * ScheduledTask @struct a spawned task waiting in a deque
+ */
+typedef struct {
+    SchedulerTask function;         // Task to run
+    void* context;                  // Context it is called with
+    int index;                      // Index it is called with
+    TaskGroup* group;               // Group it belongs to
+} ScheduledTask;
+
+/**
+ * TaskDeque @struct double ended queue of spawned tasks. Its owner pushes &
+ * pops at the bottom (newest first), other threads steal from the top
+ * (oldest first, usually the biggest pieces of work).
+ */
+typedef struct {
+    ScheduledTask* tasks;           // Circular buffer of tasks
+    int capacity;                   // Size of tasks
+    int top;                        // Index of the oldest task
+    int count;                      // Number of tasks queued
+    pthread_mutex_t lock;           // Guards everything above
+} TaskDeque;
+
+struct Scheduler;
+
+/**
+ * SchedulerWorker @struct one background thread of a scheduler
+ */
+typedef struct {
+    struct Scheduler* scheduler;    // Scheduler the worker belongs to
+    int index;                      // Index of the worker's deque
+    RandomState rng;                // Stream the worker picks steal victims from
+    pthread_t thread;               // Thread running the worker
+} SchedulerWorker;
+
+/**
+ * Scheduler @struct work-stealing scheduler. Every worker has its own deque of
+ * tasks; once it runs out it steals from the deque of a random other worker.
+ * Threads that aren't workers share deque 0, & help run tasks while they wait
+ * for a group, so nested fork/join (a season forking matchdays forking
+ * fixtures) never leaves a thread blocked while there's work queued.
+ */
+typedef struct Scheduler {
+    SchedulerWorker* workers;       // Background workers (numThreads - 1 of them, deques 1 - numThreads - 1)
+    TaskDeque* deques;              // Deque of each worker, deque 0 is shared by outside threads
+    int numDeques;                  // Deques allocated (& their locks initialized), one per requested thread
+    int numThreads;                 // Threads running tasks, counting one outside thread
+    pthread_mutex_t lock;           // Guards shuttingDown, held by threads falling asleep on changed
+    pthread_cond_t changed;         // Signalled when a task is queued or a group finishes
+    int numQueued;                  // Tasks queued in all deques (updated atomically)
+    int numSleeping;                // Threads asleep on changed (updated atomically, raised under lock)
+    bool shuttingDown;              // True once the scheduler is being destroyed
+} Scheduler;
+
+/**
+ * Create a work-stealing scheduler
+ *
+ * @param numThreads that run tasks, counting the outside thread waiting on them
+ *        (<= 0 => one per online CPU)
+ *
+ * @return pointer to the new scheduler, NULL if it couldn't be created
+ */
+Scheduler* createScheduler(int numThreads);
+
+/**
+ * Stop the workers of a scheduler & free it. Every group must have been
+ * waited for.
+ *
+ * @param scheduler that we want to destroy
+ */
+void destroyScheduler(Scheduler* scheduler);
+
+/**
+ * Initialize an empty task group
+ *
+ * @param group that we want to initialize
+ */
+void initTaskGroup(TaskGroup* group);
+
+/**
+ * Spawn a task into a group. It may start right away on another thread, or
+ * (without a scheduler) run before this returns.
+ *
+ * @param scheduler that runs the task (NULL => run it on the calling thread)
+ * @param group the task belongs to
+ * @param task to run
+ * @param context passed to task
+ * @param index passed to task
+ */
+void spawnTask(Scheduler* scheduler, TaskGroup* group, SchedulerTask task, void* context, int index);
+
+/**
+ * Wait for every task of a group, running queued tasks in the meantime
+ *
+ * @param scheduler the group's tasks were spawned on
+ * @param group that we are waiting for
+ */
+void waitTaskGroup(Scheduler* scheduler, TaskGroup* group);
+
+/**
+ * Run a task once for each index & wait for all of them (a parallel for loop).
+ * Tasks of the loop run concurrently, so they must not touch the same mutable
+ * data.
+ *
+ * @param scheduler that runs the tasks (NULL => run them on the calling thread)
+ * @param task called once for each index (0 - numTasks - 1)
+ * @param context passed to every call of task
+ * @param numTasks in the loop
+ */
+void runScheduler(Scheduler* scheduler, SchedulerTask task, void* context, int numTasks);
+
+/**
+ * Get the number of threads that run a scheduler's tasks
+ *
+ * @param scheduler that we want the size of
+ *
+ * @return number of threads, counting one outside thread (1 for a NULL scheduler)
+ */
+int getSchedulerSize(const Scheduler* scheduler);
+
+#endif
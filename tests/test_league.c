@@ -9,6 +9,8 @@
 #include "match.h"
 #include "league.h"
 #include "modules/match_simulation.h"
+#include "modules/standings.h"
+#include "modules/season_odds.h"
 #include "random_utils.h"
 
 // Function to create a team with some players
@@ -40,6 +42,10 @@ Team* createTestTeam(const char* name, const char* city, const char* coach, cons
 int main() {
     printf("Creating a test league...\n");
     League* league = createLeague("Test League", "Test Region", 20);
+
+    // Simulate each matchday's fixtures on a few threads
+    Scheduler* scheduler = createScheduler(4);
+    setLeagueScheduler(league, scheduler);
     
     
     
@@ -83,6 +89,14 @@ int main() {
         printLeagueTable(league);
         printf("\n");
         
+        // Play the rest of the season many times over, without touching the league
+        SeasonOdds* odds = simulateSeasonOdds(league, 20000, 7);
+        if (odds != NULL) {
+            printSeasonOdds(league, odds);
+            printf("\n");
+            destroySeasonOdds(odds);
+        }
+        
         // Simulate the rest of the season
         printf("Simulating the rest of the season...\n");
         while (league->currentMatchday < league->numMatchdays) {
@@ -100,12 +114,44 @@ int main() {
             int position = getTeamPosition(league, team);
             printf("%s finished in position %d\n", team->name, position);
         }
+
+        // Look a team up by name, then by its interned name id
+        Team* teamC = getTeamByName(league, "Team C");
+        int teamCId = findNameId(league->nameIndex, "Team C");
+        printf("\nFound %s by name, id %d resolves to %s\n", teamC->name, teamCId, 
+               getTeamByNameId(league, teamCId)->name);
+
+        // Get the champion straight from the table
+        printf("\nChampion: %s\n", getTeamAtPosition(league, 1)->name);
+
+        // Re-rank the final table with head-to-head tiebreakers first
+        TiebreakRule rules[] = { TIEBREAK_HEAD_TO_HEAD_POINTS, TIEBREAK_HEAD_TO_HEAD_GOAL_DIFFERENCE, 
+                                 TIEBREAK_GOAL_DIFFERENCE, TIEBREAK_GOALS_SCORED };
+        if (setLeagueTiebreakRules(league, rules, 4)) {
+            printf("\nFinal league table with head-to-head tiebreakers:\n");
+            printLeagueTable(league);
+        }
     } else {
         printf("Failed to generate schedule.\n");
     }
     
+    // Rank two small standings tables in one batched call
+    printf("\nBatch ranking two tables of 3 teams:\n");
+    uint64_t keys[6] = {
+        packStandingsKey(4, 1, 3, 2), packStandingsKey(4, 2, 2, 1), packStandingsKey(1, -3, 1, 0),
+        packStandingsKey(3, 0, 2, 2), packStandingsKey(3, 0, 2, 1), packStandingsKey(6, 3, 4, 0)
+    };
+    int order[6];
+    if (rankStandingsBatch(keys, 2, 3, order)) {
+        for (int table = 0; table < 2; table++) {
+            printf("Table %d: slots %d, %d, %d\n", table + 1,
+                   order[table * 3], order[table * 3 + 1], order[table * 3 + 2]);
+        }
+    }
+
     // Clean up
     destroyLeague(league);
+    destroyScheduler(scheduler);
     
     printf("\nLeague test completed successfully.\n");
     return 0;
@@ -9,6 +9,7 @@
 #include "modules/match_simulation.h"
 #include "team.h"
 #include "player.h"
+#include "random_utils.h"
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -50,7 +51,7 @@ int main() {
     
     // Simulate the match
     printf("===== SIMULATING EL CLASICO =====\n\n");
-    simulateMatch(elClasico);
+    simulateMatch(elClasico, getDefaultRandomState());
     
     // Print match result
     printf("===== MATCH RESULT =====\n\n");
@@ -63,8 +64,26 @@ int main() {
     printf("\n");
     printTeam(realMadrid, true);
     printf("\n");
+
+    // Simulate the return leg with the binomial engine
+    printf("===== SIMULATING THE RETURN LEG (BINOMIAL ENGINE) =====\n\n");
+    Match* returnLeg = createMatch(realMadrid, barcelona, "2024-04-21");
+    returnLeg -> engine = MATCH_ENGINE_BINOMIAL;
+    simulateMatch(returnLeg, getDefaultRandomState());
+    printMatchReport(returnLeg);
+    printf("\n");
+
+    // Simulate a friendly with the event driven engine
+    printf("===== SIMULATING A FRIENDLY (EVENT ENGINE) =====\n\n");
+    Match* friendly = createMatch(barcelona, realMadrid, "2024-07-29");
+    friendly -> engine = MATCH_ENGINE_EVENT;
+    simulateMatch(friendly, getDefaultRandomState());
+    printMatchReport(friendly);
+    printf("\n");
     
     // Clean up
+    destroyMatch(friendly);
+    destroyMatch(returnLeg);
     destroyMatch(elClasico);
     destroyTeam(barcelona);
     destroyTeam(realMadrid);
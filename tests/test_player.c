@@ -39,12 +39,18 @@ int main()
 
     // Try making a copy of Messi
     printf("Cloning Messi...\n");
-    Player* messi_clone = createPlayer(0, "", "", 1);
+    Player* messi_clone = createPlayer(0, "gkp", "", 1);
     copyPlayer(lionel_messi, messi_clone);
     printf("Done! Printing the clones information...\n");
     printPlayer(messi_clone);
     printf("\n");
 
+    // Positions are parsed when the player is created
+    printf("Creating a player with an unknown position...\n");
+    Player* unknown = createPlayer(99, "xyz", "Nobody", 50);
+    printf("Player was %s\n", (unknown == NULL) ? "rejected" : "created");
+    printf("\n");
+
     // Cleaning up
     destroyPlayer(messi_clone);
     destroyPlayer(lionel_messi);
@@ -53,6 +53,16 @@ int main()
         destroyPlayer(foundPlayer2);
     }
 
+    // Test get player by name
+    printf("\nGetting player named Robert Lewandowski...\n");
+    Player* foundPlayer3 = getPlayerByName(barca, "Robert Lewandowski");
+    if (foundPlayer3 != NULL)
+    {
+        printPlayer(foundPlayer3);
+    } else {
+        printf("Could not find player named Robert Lewandowski\n");
+    }
+
     // Test update record
     printf("\nUpdating team record (win)...\n");
     updateRecord(barca, true, false, false);
@@ -72,13 +82,30 @@ int main()
     printf("Team record after loss: %d-%d-%d (W-L-D), Points: %d\n", 
         barca->wins, barca->losses, barca->draws, barca->points);
 
+    // Test changing a player's rating
+    printf("\nTeam rating before rating change: %.2f\n", getTeamRating(barca));
+    printf("Changing Robert Lewandowski's rating to 92...\n");
+    setPlayerRating(barca, 9, 92);
+    printf("Team rating after rating change: %.2f (recalculated: %.2f)\n", 
+        getTeamRating(barca), calculateTeamRating(barca));
+
+    // Test changing a player's injury status
+    printf("\nInjuring Robert Lewandowski through the team...\n");
+    setPlayerInjuryStatus(barca, 9, true);
+    printf("Injured: %s, samplers need a rebuild: %s\n", 
+        getPlayerByNumber(barca, 9)->injuryStatus ? "yes" : "no", barca->samplersDirty ? "yes" : "no");
+    printf("Roster entry of number 9: rating %d, injured: %s\n", 
+        barca->roster[barca->jerseySlots[9]].rating, barca->roster[barca->jerseySlots[9]].injured ? "yes" : "no");
+    setPlayerInjuryStatus(barca, 9, false);
+
     // Test removing a player by their number
     printf("\nRemoving a player with number 19 (seniority)...\n");
     removePlayerByNumber(barca, 19);
     printf("\nTeam after removal...\n");
     printTeam(barca, true);
 
-    // Test removing a player by their number
+    // Test removing a player by their name, keeping the roster order this time
+    setStableRosterOrder(barca, true);
     printf("\nRemoving a player with name Raphael Dias Belloli (seniority)...\n");
     removePlayerByName(barca, raphinha -> name);
     printf("\nTeam after removal...\n");
@@ -9,6 +9,7 @@
 #include "match.h"
 #include "tournament.h"
 #include "modules/match_simulation.h"
+#include "modules/tournament_odds.h"
 #include "random_utils.h"
  
  // Function to create a team with some players
@@ -40,6 +41,10 @@ Team* createTestTeam(const char* name, const char* city, const char* coach, cons
 int main() {    
     printf("Creating a test tournament...\n");
     Tournament* tournament = createTournament("Champions League");
+
+    // Simulate each round's matches on a few threads
+    Scheduler* scheduler = createScheduler(4);
+    setTournamentScheduler(tournament, scheduler);
     
     // Create and add teams to the tournament
     printf("Adding teams to the tournament...\n");
@@ -59,10 +64,26 @@ int main() {
     addTeamToTournament(tournament, createTestTeam("PSV", "Eindhoven", "Peter Bosz", "Philips Stadion"));
     addTeamToTournament(tournament, createTestTeam("PSG", "Paris", "Luis Enrique", "Parc des Princes"));
     addTeamToTournament(tournament, createTestTeam("Benfica", "Lisbon", "Roger Schmidt", "Estádio da Luz"));
+
+    // Add a late entry, then withdraw it by name (found through the name index)
+    Team* celtic = createTestTeam("Celtic", "Glasgow", "Brendan Rodgers", "Celtic Park");
+    addTeamToTournament(tournament, celtic);
+    if (removeTeamFromTournament(tournament, "Celtic")) {
+        printf("Celtic withdrew, %d teams remain.\n", tournament->numTeams);
+    }
+    destroyTeam(celtic);  // The tournament doesn't own its teams
+    
+    // Odds of every team reaching each round, over many draws & brackets
+    printf("\n");
+    TournamentOdds* odds = simulateTournamentOdds(tournament, 50000, 11);
+    if (odds != NULL) {
+        printTournamentOdds(odds);
+        destroyTournamentOdds(odds);
+    }
     
     // Draw the tournament
     printf("\nDrawing tournament bracket...\n");
-    if (drawTournament(tournament)) {
+    if (drawTournament(tournament, getDefaultRandomState())) {
         printf("Tournament drawn successfully.\n\n");
         
         // Print the initial bracket
@@ -105,6 +126,7 @@ int main() {
     
     // Clean up
     destroyTournament(tournament);
+    destroyScheduler(scheduler);
     
     printf("\nTournament test completed successfully.\n");
     return 0;